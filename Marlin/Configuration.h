@@ -999,6 +999,14 @@
   // and processor overload (too many expensive sqrt calls).
   #define DEFAULT_SEGMENTS_PER_SECOND 200
 
+  // Step the tower heights from one segment to the next with forward differences
+  // instead of three square roots per segment, allowing more segments per second.
+  // Heights are recalculated exactly as often as needed to stay within tolerance.
+  //#define DELTA_INCREMENTAL_IK
+  #if ENABLED(DELTA_INCREMENTAL_IK)
+    #define DELTA_IK_TOLERANCE 0.001      // (mm) Allowed drift between exact recalculations
+  #endif
+
   // After homing move down to a height where XY movement is unconstrained
   //#define DELTA_HOME_TO_SAFE_ZONE
 
@@ -1013,6 +1021,10 @@
   #if ENABLED(DELTA_AUTO_CALIBRATION)
     // Default number of probe points : n*n (1 -> 7)
     #define DELTA_CALIBRATION_DEFAULT_POINTS 4
+
+    // Add 'G33 L' to probe once at many points and fit the endstops, radius,
+    // diagonal rod and tower angles together by least squares.
+    //#define DELTA_CALIBRATION_LEAST_SQUARES
   #endif
 
   #if ANY(DELTA_AUTO_CALIBRATION, DELTA_CALIBRATION_MENU)
@@ -1709,6 +1721,20 @@
 //#define MULTIPLE_PROBING 2
 //#define EXTRA_PROBING    1
 
+/**
+ * Adaptive Multiple Probing
+ *
+ * Stop probing a point as soon as MULTIPLE_PROBING readings agree, so only
+ * noisy points get the EXTRA_PROBING readings. The readings that agree best
+ * are averaged and the rest are dropped. With AUTO_BED_LEVELING_BILINEAR the
+ * spread of the readings at each point is kept with the mesh.
+ * Requires EXTRA_PROBING.
+ */
+//#define ADAPTIVE_PROBING
+#if ENABLED(ADAPTIVE_PROBING)
+  #define ADAPTIVE_PROBING_TOLERANCE 0.01 // (mm) Largest spread of readings that agree
+#endif
+
 /**
  * Z probes require clearance when deploying, stowing, and moving between
  * probe points to avoid hitting the bed and other hardware.
@@ -2168,6 +2194,13 @@
   #define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
 
+  /**
+   * Precompute the bilinear patch of every mesh cell whenever the mesh changes,
+   * so each Z correction is a single table lookup and a few multiply-adds.
+   * Uses 16 bytes of SRAM per mesh cell. Requires AUTO_BED_LEVELING_BILINEAR or UBL.
+   */
+  //#define MESH_CELL_COEFFICIENTS
+
   /**
    * Enable the G26 Mesh Validation Pattern tool.
    */
@@ -2225,6 +2258,17 @@
 
   //#define UBL_HILBERT_CURVE       // Use Hilbert distribution for less travel when probing multiple points
 
+  /**
+   * Adaptive probing for G29 P1. Probe a coarse grid first, then probe in full
+   * only the cells where the bed deviates from a local best-fit plane.
+   * Other points are interpolated. Combine with UBL_HILBERT_CURVE for less travel.
+   */
+  //#define UBL_ADAPTIVE_PROBING
+  #if ENABLED(UBL_ADAPTIVE_PROBING)
+    #define UBL_ADAPTIVE_STRIDE      3  // Mesh lines per coarse cell
+    #define UBL_ADAPTIVE_TOLERANCE 0.02 // (mm) Probe cells in full where the bed deviates more than this
+  #endif
+
   //#define UBL_TILT_ON_MESH_POINTS         // Use nearest mesh points with G29 J for better Z reference
   //#define UBL_TILT_ON_MESH_POINTS_3POINT  // Use nearest mesh points with G29 J0 (3-point)
 
@@ -782,6 +782,21 @@
 // enable this option. Override at any time with M120, M121.
 //#define ENDSTOPS_ALWAYS_ON_DEFAULT
 
+/**
+ * Endstop Capture
+ * Timestamp each endstop and probe edge and use the step timing to work out
+ * where the axes were at that moment, between steps. The steppers still stop
+ * a little later, but homing and probing use the captured position. Allows
+ * faster probing (G29, M48) for the same repeatability.
+ *
+ * Requires ENDSTOP_INTERRUPTS_FEATURE, or a HAL that defines ENDSTOP_EDGE_TIME(pin)
+ * to read a timer input capture. Polled endstops are only seen after the steps.
+ */
+//#define ENDSTOP_CAPTURE
+#if ENABLED(ENDSTOP_CAPTURE)
+  #define ENDSTOP_CAPTURE_STEPS 32  // Step times to keep. Covers the steps made from the edge to the stop.
+#endif
+
 // @section extras
 
 //#define Z_LATE_ENABLE // Enable Z the last moment. Needed if your Z driver overheats.
@@ -1149,6 +1164,8 @@
 
   //#define FT_MOTION_MENU                        // Provide a MarlinUI menu to set M493 parameters
 
+  //#define FTM_ARC_BLOCKS                        // Queue each G2/G3 arc as a single block traced by FT Motion (requires ARC_SUPPORT)
+
   /**
    * Advanced configuration
    */
@@ -1305,6 +1322,13 @@
   // to reduce print artifacts. (Enabling this is costly in memory and computation!)
   //#define BACKLASH_SMOOTHING_MM 3 // (mm)
 
+  // Take up backlash with extra steps from the Stepper ISR, spaced out like babysteps,
+  // instead of adding steps to planner blocks. Block lengths and speeds are left as planned.
+  //#define BACKLASH_IN_STEPPER
+  #if ENABLED(BACKLASH_IN_STEPPER)
+    #define BACKLASH_TAKEUP_FEEDRATE 20 // (linear=mm/s, rotational=°/s) Rate of the take-up steps
+  #endif
+
   // Add runtime configuration and tuning of backlash values (M425)
   //#define BACKLASH_GCODE
 
@@ -1396,6 +1420,45 @@
  */
 #define MULTISTEPPING_LIMIT   16  //: [1, 2, 4, 8, 16, 32, 64, 128]
 
+/**
+ * Step Event Stream
+ * Compute step timing and Bresenham ahead of time, outside of the Stepper ISR,
+ * and queue the results as step events. The Stepper ISR only has to apply the
+ * next event and reload the timer, so it is much shorter and more regular.
+ * Endstops are checked against the steps applied, not the ones queued ahead.
+ * Takes the place of multi-stepping. Requires a 32-bit MCU.
+ * Not compatible with LASER_FEATURE or Z_LATE_ENABLE, which act at block start.
+ */
+//#define STEP_EVENT_STREAM
+#if ENABLED(STEP_EVENT_STREAM)
+  #define STEP_EVENT_BUFFER_SIZE 512  // Step events queued ahead (power of 2). 8 bytes each on most MCUs.
+#endif
+
+/**
+ * Step Pulse Train
+ * Moves of a single motor (homing, Z moves, retracts, filament loads) are
+ * handed to a HAL timer that makes all the step pulses by itself, from the
+ * step periods worked out when the move starts. The Stepper ISR wakes up
+ * again when the last pulse is due. Requires HAL support.
+ */
+//#define STEP_PULSE_TRAIN
+#if ENABLED(STEP_PULSE_TRAIN)
+  #define STEP_PULSE_TRAIN_RAMP 32    // (16-64) Most steps to accelerate or decelerate. Longer ramps use the Stepper ISR.
+#endif
+
+/**
+ * Motion Core
+ * On a dual-core MCU (RP2040, ESP32) run the planner on the second core.
+ * G-code, temperature, UI and storage stay on the first core and hand moves over
+ * through a lock-free queue, so UI redraws and SD reads can't starve the planner.
+ * The main core only waits for the motion core when the queue is full.
+ * Not compatible with FT_MOTION or STEP_EVENT_STREAM.
+ */
+//#define MOTION_CORE
+#if ENABLED(MOTION_CORE)
+  #define MOTION_CORE_QUEUE_SIZE 16   // Moves queued for the motion core (power of 2)
+#endif
+
 /**
  * Adaptive Step Smoothing increases the resolution of multi-axis moves, particularly at step frequencies
  * below 1kHz (for AVR) or 10kHz (for ARM), where aliasing between axes in multi-axis moves causes audible
@@ -1859,6 +1922,16 @@
 
   //#define AUTO_REPORT_SD_STATUS         // Auto-report media status with 'M27 S<seconds>'
 
+  /**
+   * Pre-scan the selected file in the background to find its layers and
+   * estimate its print time. The index is saved as FILENAME.IDX beside the
+   * file and reused while the file is unchanged. With an index the print
+   * progress is based on time instead of bytes, and 'M26 L<layer>' moves
+   * the file position to the start of a layer. Power-loss recovery doesn't
+   * use the index. It saves and restores the exact file position.
+   */
+  //#define SD_PRESCAN
+
   /**
    * Support for USB thumb drives using an Arduino USB Host Shield or
    * equivalent MAX3421E breakout board. The USB thumb drive will appear
@@ -2463,6 +2536,18 @@
    */
   //#define PTC_LINEAR_EXTRAPOLATION 4
 
+  /**
+   * Fit a linear drift model (µm per °C of each sensor) to ordinary probing, as with G29.
+   * Each probe at a point probed before at other temperatures refines the model.
+   * The model corrects what the tables below leave over, so G76 is not required.
+   * M871 shows the model, M871 R resets it, and M500 saves it.
+   */
+  //#define PTC_ONLINE_FIT
+  #if ENABLED(PTC_ONLINE_FIT)
+    #define PTC_FIT_POINTS    16  // Number of probe points to remember
+    #define PTC_FIT_MIN_DELTA  2  // (°C) Smallest temperature change to learn from
+  #endif
+
   #if ENABLED(PTC_PROBE)
     // Probe temperature calibration generates a table of values starting at PTC_PROBE_START
     // (e.g., 30), in steps of PTC_PROBE_RES (e.g., 5) with PTC_PROBE_COUNT (e.g., 10) samples.
@@ -2544,6 +2629,13 @@
  * Preparing your G-code: https://github.com/colinrgodsey/step-daemon
  */
 //#define DIRECT_STEPPING
+#if ENABLED(DIRECT_STEPPING)
+  //#define STEPPER_PAGES 16                // Pages in the pool (4-256, a multiple of 4). The host can use fewer with G6 P.
+  //#define STEPPER_PAGE_FORMAT SP_4x2_256  // SP_4x4D_128, SP_4x2_256, or SP_4x1_512
+  //#define DIRECT_STEPPING_COMPRESSION     // Also accept heatshrink-compressed pages (window 8, lookahead 4)
+  // On 32-bit boards pages are read by the main loop and idle(), so the serial
+  // RX buffer holds what comes in between. Set RX_BUFFER_SIZE to 256 or more.
+#endif
 
 /**
  * G38 Probe Target
@@ -2798,6 +2890,16 @@
     //#define EVENT_GCODE_AFTER_TOOLCHANGE "G12X"   // Extra G-code to run after tool-change
   #endif
 
+  /**
+   * Queue the tool-change raise, park, retract, prime and return moves
+   * instead of waiting for each one to finish, so they blend together with
+   * lookahead. The planner is still emptied before any servo, solenoid,
+   * docking move, temperature wait, fan switch, or tool-change G-code event.
+   * With a filament swap fan (TOOLCHANGE_FS_FAN) the swap moves are waited
+   * for, so the fan is off while they run.
+   */
+  //#define TOOLCHANGE_QUEUED_MOVES
+
   /**
    * Extra G-code to run while executing tool-change commands. Can be used to use an additional
    * stepper motor (e.g., I axis in Configuration.h) to drive the tool-changer.
@@ -3733,6 +3835,18 @@
      */
     //#define LASER_POWER_TRAP
 
+    /**
+     * Raster engraving with one planner block per scanline.
+     * M650 uploads the pixel powers (base64, 0-255 scaled by S) for the next
+     * powered G1, and the power is set for each pixel as the move goes along.
+     * Requires inline mode (M3 I).
+     */
+    //#define LASER_RASTER
+    #if ENABLED(LASER_RASTER)
+      #define LASER_RASTER_PIXELS 256   // Most pixels in one line
+      #define LASER_RASTER_LINES    4   // Lines queued for blocks in the planner
+    #endif
+
     //
     // Laser I2C Ammeter (High precision INA226 low/high side module)
     //
@@ -3819,6 +3933,21 @@
 
   // Display filament width on the LCD status line. Status messages will expire after 5 seconds.
   //#define FILAMENT_LCD_DISPLAY
+
+  /**
+   * Flow Compensation
+   * Scale the E of each printing move for the width measured when its filament passed the sensor,
+   * instead of setting the flow for whatever the sensor saw one delay ago. M407 reports the width
+   * error and the corrections applied. With a filament motion sensor on the same extruder the feed
+   * is also compared with the motion the sensor sees, to make up for the extruder slipping.
+   */
+  //#define FILWIDTH_FLOW_COMPENSATION
+  #if ENABLED(FILWIDTH_FLOW_COMPENSATION)
+    #define FLOWCOMP_SEGMENT_MM          5  // (mm) Filament length per stored width. 4 bytes SRAM each, up to MAX_MEASUREMENT_DELAY.
+    #define FLOWCOMP_MAX_CORRECTION     10  // (%) Largest change to the E of a block
+    //#define FLOWCOMP_ENCODER_MM     2.88  // (mm) Filament motion per motion sensor edge. Requires FILAMENT_MOTION_SENSOR.
+    #define FLOWCOMP_ENCODER_WINDOW_MM  50  // (mm) Filament fed per slip measurement
+  #endif
 #endif
 
 // @section power
@@ -3970,6 +4099,15 @@
 //#define MEATPACK_ON_SERIAL_PORT_1
 //#define MEATPACK_ON_SERIAL_PORT_2
 
+/**
+ * Accept heatshrink-compressed frames of G-code, mixed with plain G-code.
+ * Decompression comes before MeatPack, so both may be used on one port.
+ * With typical sliced G-code, hosts can send about 1.6x more commands per second.
+ * Frames are described in feature/stream_decode.h.
+ */
+//#define HEATSHRINK_ON_SERIAL_PORT_1
+//#define HEATSHRINK_ON_SERIAL_PORT_2
+
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
 //#define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
@@ -4165,6 +4303,8 @@
 //#define CANCEL_OBJECTS
 #if ENABLED(CANCEL_OBJECTS)
   #define CANCEL_OBJECTS_REPORTING // Emit the current object as a status message
+  #define CANCEL_OBJECTS_MAX 32    // Highest object index + 1 that can be canceled (1-127)
+  #define CANCEL_OBJECTS_SD_SKIP   // Skip the moves of a canceled object in an SD print without queueing them
 #endif
 
 /**
@@ -4504,6 +4644,16 @@
 
     #define MMU3_MAX_RETRIES 3  // Number of retries (total time = timeout*retries)
 
+    /**
+     * Poll the MMU for progress while a command runs instead of waiting out the
+     * 1s heartbeat. The first query goes out as soon as the MMU accepts a command,
+     * then one every MMU3_QUERY_PERIOD, so each tool change sees the MMU finish sooner.
+     */
+    //#define MMU3_PIPELINED_QUERIES
+    #if ENABLED(MMU3_PIPELINED_QUERIES)
+      #define MMU3_QUERY_PERIOD 100 // (ms) Less than the 1000ms heartbeat
+    #endif
+
     // As discussed with our PrusaSlicer profile specialist
     // - ToolChange shall not try to push filament into the very tip of the nozzle
     // to have some space for additional G-code to tune the extruded filament length
@@ -4619,6 +4769,12 @@
 //
 //#define M100_FREE_MEMORY_WATCHER
 
+//
+// M101 - Stepper ISR Profiler to see how busy the Stepper ISR is and
+//        which phase (pulse, block, advance, shaping, babystep) costs the most.
+//
+//#define STEPPER_ISR_PROFILING
+
 //
 // M42 - Set pin states
 //
@@ -175,6 +175,23 @@ uint8_t MarlinHAL::get_reset_source() { return rtc_get_reset_reason(1); }
 
 void MarlinHAL::reboot() { ESP.restart(); }
 
+#if ENABLED(MOTION_CORE)
+
+  static TaskHandle_t motion_core_handle = nullptr;
+
+  static void motion_core_loop(void *task) {
+    for (;;) ((void (*)())task)();
+  }
+
+  // Run on the core that isn't running Marlin's loop()
+  void MarlinHAL::motion_core_start(void (*task)()) {
+    xTaskCreatePinnedToCore(motion_core_loop, "MotionTask", 8192, (void*)task, 2, &motion_core_handle, !CONFIG_ARDUINO_RUNNING_CORE);
+  }
+
+  bool MarlinHAL::on_motion_core() { return motion_core_handle && xTaskGetCurrentTaskHandle() == motion_core_handle; }
+
+#endif
+
 void _delay_ms(const int ms) { delay(ms); }
 
 // return free memory between end of heap (or end bss) and whatever is current
@@ -199,6 +199,13 @@ public:
   // Tasks, called from idle()
   static void idletask();
 
+  #if ENABLED(MOTION_CORE)
+    // FreeRTOS task pinned to the other core, running task() over and over
+    static void motion_core_start(void (*task)());
+    static bool on_motion_core();
+    static void motion_core_yield() { vTaskDelay(1); } // Let the idle task feed the watchdog
+  #endif
+
   // Reset
   static uint8_t get_reset_source();
   static void clear_reset_source() {}
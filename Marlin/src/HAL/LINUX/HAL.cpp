@@ -58,6 +58,25 @@ uint16_t MarlinHAL::adc_value() {
 
 void MarlinHAL::reboot() { /* Reset the application state and GPIO */ }
 
+#if ENABLED(MOTION_CORE)
+
+  #include <thread>
+
+  static thread_local bool is_motion_thread = false;
+
+  void MarlinHAL::motion_core_start(void (*task)()) {
+    std::thread([task]{
+      is_motion_thread = true;
+      for (;;) task();
+    }).detach();
+  }
+
+  bool MarlinHAL::on_motion_core() { return is_motion_thread; }
+
+  void MarlinHAL::motion_core_yield() { std::this_thread::yield(); }
+
+#endif
+
 // ------------------------
 // BSD String
 // ------------------------
@@ -84,6 +84,9 @@ extern MSerialT usb_serial;
 #define CRITICAL_SECTION_START()
 #define CRITICAL_SECTION_END()
 
+// The simulated pins keep the time of their last edge, like a timer input capture
+#define ENDSTOP_EDGE_TIME(IO) Gpio::edgeTime(IO)
+
 // ADC
 #define HAL_ADC_VREF_MV   5000
 #define HAL_ADC_RESOLUTION  10
@@ -129,6 +132,13 @@ public:
   // Tasks, called from idle()
   static void idletask() {}
 
+  #if ENABLED(MOTION_CORE)
+    // A second thread stands in for the second core
+    static void motion_core_start(void (*task)());
+    static bool on_motion_core();
+    static void motion_core_yield();
+  #endif
+
   // Reset
   static constexpr uint8_t reset_reason = RST_POWER_ON;
   static uint8_t get_reset_source() { return reset_reason; }
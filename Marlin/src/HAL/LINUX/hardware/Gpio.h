@@ -64,6 +64,7 @@ struct pin_data {
   uint8_t dir;
   uint8_t mode;
   uint16_t value;
+  uint32_t edge;  // Time (µs) of the last rise or fall
   Peripheral* cb;
 };
 
@@ -86,6 +87,7 @@ public:
     GpioEvent::Type evt_type = value > 1 ? GpioEvent::SET_VALUE : value > pin_map[pin].value ? GpioEvent::RISE : value < pin_map[pin].value ? GpioEvent::FALL : GpioEvent::NOP;
     pin_map[pin].value = value;
     GpioEvent evt(Clock::nanos(), pin, evt_type);
+    if (evt_type == GpioEvent::RISE || evt_type == GpioEvent::FALL) pin_map[pin].edge = evt.timestamp / 1000;
     if (pin_map[pin].cb) {
       pin_map[pin].cb->interrupt(evt);
     }
@@ -101,6 +103,18 @@ public:
     set(pin, 0);
   }
 
+  // Set a pin from a peripheral, keeping the time of an edge
+  static void setInput(pin_type pin, uint16_t value, uint64_t timestamp) {
+    if (!valid_pin(pin)) return;
+    if (value != pin_map[pin].value) pin_map[pin].edge = timestamp / 1000;
+    pin_map[pin].value = value;
+  }
+
+  static uint32_t edgeTime(pin_type pin) {
+    if (!valid_pin(pin)) return 0;
+    return pin_map[pin].edge;
+  }
+
   static void setMode(pin_type pin, uint8_t value) {
     if (!valid_pin(pin)) return;
     pin_map[pin].mode = value;
@@ -90,6 +90,12 @@ void Timer::disable() {
   active = false;
 }
 
+// Disarm this timer only. disable() masks the signal for all the timers.
+void Timer::stop() {
+  struct itimerspec its = {};
+  timer_settime(timerid, 0, &its, nullptr);
+}
+
 void Timer::setCompare(uint32_t compare) {
   uint32_t nsec_offset = 0;
   if (active) {
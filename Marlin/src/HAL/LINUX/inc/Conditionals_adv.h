@@ -20,3 +20,6 @@
  *
  */
 #pragma once
+
+// The simulated pins keep the time of their last edge. See ENDSTOP_EDGE_TIME in HAL.h.
+#define HAS_ENDSTOP_EDGE_TIME 1
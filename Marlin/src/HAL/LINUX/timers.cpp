@@ -32,12 +32,14 @@
 
 HAL_STEP_TIMER_ISR();
 HAL_TEMP_TIMER_ISR();
+TERN_(STEP_PULSE_TRAIN, HAL_PULSE_TRAIN_ISR());
 
-Timer timers[2];
+Timer timers[3];
 
 void HAL_timer_init() {
   timers[0].init(0, STEPPER_TIMER_RATE, TIMER0_IRQHandler);
   timers[1].init(1, TEMP_TIMER_RATE, TIMER1_IRQHandler);
+  TERN_(STEP_PULSE_TRAIN, timers[2].init(2, STEPPER_TIMER_RATE, TIMER2_IRQHandler));
 }
 
 void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency) {
@@ -68,4 +70,43 @@ hal_timer_t HAL_timer_get_count(const uint8_t timer_num) {
   return timers[timer_num].getCount();
 }
 
+#if ENABLED(STEP_PULSE_TRAIN)
+
+  #include "../../module/stepper/pulse_train.h"
+
+  static const PulseTrain *train;
+  static volatile uint32_t train_pulses;
+  static volatile bool train_busy;
+
+  // Make a pulse and wait for the next, as the timer hardware would
+  HAL_PULSE_TRAIN_ISR() {
+    if (!train_busy) return;
+    WRITE(train->pin, train->active);
+    WRITE(train->pin, !train->active);
+    if (++train_pulses < train->steps)
+      timers[2].setCompare(train->period(train_pulses));
+    else {
+      timers[2].stop();
+      train_busy = false;
+    }
+  }
+
+  void HAL_pulse_train_start(const PulseTrain &t) {
+    train = &t;
+    train_pulses = 0;
+    train_busy = true;
+    timers[2].enable();
+    timers[2].setCompare(t.period(0));
+  }
+
+  bool HAL_pulse_train_busy() { return train_busy; }
+
+  uint32_t HAL_pulse_train_stop() {
+    train_busy = false;
+    timers[2].stop();
+    return train_pulses;
+  }
+
+#endif // STEP_PULSE_TRAIN
+
 #endif // __PLAT_LINUX__
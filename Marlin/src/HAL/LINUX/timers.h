@@ -73,6 +73,10 @@ typedef uint32_t hal_timer_t;
   #define HAL_TEMP_TIMER_ISR()  extern "C" void TIMER1_IRQHandler()
 #endif
 
+// A timer makes step pulse trains, standing in for one reloaded by DMA
+#define HAL_PULSE_TRAIN
+#define HAL_PULSE_TRAIN_ISR() extern "C" void TIMER2_IRQHandler()
+
 // PWM timer
 #define HAL_PWM_TIMER
 #define HAL_PWM_TIMER_ISR()   extern "C" void TIMER3_IRQHandler()
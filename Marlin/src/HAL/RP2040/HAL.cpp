@@ -101,6 +101,18 @@ uint8_t MarlinHAL::get_reset_source() {
 
 void MarlinHAL::reboot() { watchdog_reboot(0, 0, 1); }
 
+#if ENABLED(MOTION_CORE)
+
+  static void (* volatile motion_core_task)() = nullptr;
+
+  void MarlinHAL::motion_core_start(void (*task)()) { motion_core_task = task; }
+
+  // The Arduino core runs setup1() and loop1() on core 1 when they are defined
+  void setup1() {}
+  void loop1() { if (motion_core_task) motion_core_task(); }
+
+#endif
+
 // ------------------------
 // Watchdog Timer
 // ------------------------
@@ -201,6 +201,13 @@ public:
   // Tasks, called from idle()
   static void idletask() {}
 
+  #if ENABLED(MOTION_CORE)
+    // Second core, running task() over and over
+    static void motion_core_start(void (*task)());
+    static bool on_motion_core() { return get_core_num() == 1; }
+    static void motion_core_yield() { tight_loop_contents(); }
+  #endif
+
   // Reset
   static uint8_t get_reset_source();
   static void clear_reset_source() {}
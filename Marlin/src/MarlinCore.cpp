@@ -54,6 +54,10 @@
   #include "module/ft_motion.h"
 #endif
 
+#if ENABLED(MOTION_CORE)
+  #include "module/motion_core.h"
+#endif
+
 #include "gcode/gcode.h"
 #include "gcode/parser.h"
 #include "gcode/queue.h"
@@ -814,6 +818,9 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // Handle SD Card insert / remove
   TERN_(HAS_MEDIA, card.manage_media());
 
+  // Pre-scan the selected file
+  TERN_(SD_PRESCAN, file_index.task());
+
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
 
@@ -874,6 +881,7 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   #endif
 
   // Direct Stepping
+  TERN_(DIRECT_STEPPING_MAIN_RX, queue.receive_pages());
   TERN_(DIRECT_STEPPING, page_manager.write_responses());
 
   // Update the LVGL interface
@@ -882,6 +890,9 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // Manage Fixed-time Motion Control
   TERN_(FT_MOTION, ftMotion.loop());
 
+  // Print messages from the motion core
+  TERN_(MOTION_CORE, motion_core.report());
+
   IDLE_DONE:
   TERN_(MARLIN_DEV_MODE, idle_depth--);
 
@@ -1683,6 +1694,11 @@ void setup() {
     SETUP_RUN(ftMotion.init());
   #endif
 
+  // Hand the planner over to the second core. Until now it ran here.
+  #if ENABLED(MOTION_CORE)
+    SETUP_RUN(motion_core.start());
+  #endif
+
   marlin_state = MarlinState::MF_RUNNING;
 
   #ifdef STARTUP_TUNE
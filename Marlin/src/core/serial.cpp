@@ -43,6 +43,14 @@ PGMSTR(SP_P_STR, " P"); PGMSTR(SP_T_STR, " T"); PGMSTR(NUL_STR,   "");
 MAP(_N_STR, LOGICAL_AXIS_NAMES); MAP(_SP_N_STR, LOGICAL_AXIS_NAMES);
 MAP(_N_LBL, LOGICAL_AXIS_NAMES); MAP(_SP_N_LBL, LOGICAL_AXIS_NAMES);
 
+// Hook decompression if it's enabled, before Meatpack
+#if ENABLED(HEATSHRINK_ON_SERIAL_PORT_1)
+  SerialStreamT1 hsSerial1(false, __SERIAL_LEAF_1);
+#endif
+#if ENABLED(HEATSHRINK_ON_SERIAL_PORT_2)
+  SerialStreamT2 hsSerial2(false, __SERIAL_LEAF_2);
+#endif
+
 // Hook Meatpack if it's enabled on the first leaf
 #if ENABLED(MEATPACK_ON_SERIAL_PORT_1)
   SerialLeafT1 mpSerial1(false, _SERIAL_LEAF_1);
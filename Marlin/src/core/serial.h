@@ -27,6 +27,9 @@
 #if HAS_MEATPACK
   #include "../feature/meatpack.h"
 #endif
+#if HAS_HEATSHRINK_STREAM
+  #include "../feature/stream_decode.h"
+#endif
 
 //
 // Debugging flags for use by M111
@@ -51,9 +54,18 @@ extern uint8_t marlin_debug_flags;
 //
 // Step 1: Find out what the first serial leaf is
 #if HAS_MULTI_SERIAL && defined(SERIAL_CATCHALL)
-  #define _SERIAL_LEAF_1 MYSERIAL
+  #define __SERIAL_LEAF_1 MYSERIAL
+#else
+  #define __SERIAL_LEAF_1 MYSERIAL1
+#endif
+
+// Hook decompression if it's enabled on the first leaf. It comes before MeatPack.
+#if ENABLED(HEATSHRINK_ON_SERIAL_PORT_1)
+  typedef StreamDecodeSerial<decltype(__SERIAL_LEAF_1)> SerialStreamT1;
+  extern SerialStreamT1 hsSerial1;
+  #define _SERIAL_LEAF_1 hsSerial1
 #else
-  #define _SERIAL_LEAF_1 MYSERIAL1
+  #define _SERIAL_LEAF_1 __SERIAL_LEAF_1
 #endif
 
 // Hook Meatpack if it's enabled on the first leaf
@@ -73,13 +85,22 @@ extern uint8_t marlin_debug_flags;
   #define SERIAL_ASSERT(P)    if (multiSerial.portMask!=(P)) { debugger(); }
   // If we have a catchall, use that directly
   #ifdef SERIAL_CATCHALL
-    #define _SERIAL_LEAF_2 SERIAL_CATCHALL
+    #define __SERIAL_LEAF_2 SERIAL_CATCHALL
   #elif HAS_ETHERNET
     typedef ConditionalSerial<decltype(MYSERIAL2)> SerialLeafT2;  // We need to create an instance here
     extern SerialLeafT2 msSerial2;
-    #define _SERIAL_LEAF_2 msSerial2
+    #define __SERIAL_LEAF_2 msSerial2
+  #else
+    #define __SERIAL_LEAF_2 MYSERIAL2 // Don't create a useless instance here, directly use the existing instance
+  #endif
+
+  // Hook decompression if it's enabled on the second leaf
+  #if ENABLED(HEATSHRINK_ON_SERIAL_PORT_2)
+    typedef StreamDecodeSerial<decltype(__SERIAL_LEAF_2)> SerialStreamT2;
+    extern SerialStreamT2 hsSerial2;
+    #define _SERIAL_LEAF_2 hsSerial2
   #else
-    #define _SERIAL_LEAF_2 MYSERIAL2 // Don't create a useless instance here, directly use the existing instance
+    #define _SERIAL_LEAF_2 __SERIAL_LEAF_2
   #endif
 
   // Nothing complicated here
@@ -64,6 +64,7 @@ enum class SerialFeature {
   BinaryFileTransfer  = 0x02,   //!< Enabled for BinaryFile transfer support (in the future)
   Virtual             = 0x04,   //!< Enabled for virtual serial port (like Telnet / Websocket / ...)
   Hookable            = 0x08,   //!< Enabled if the serial class supports a setHook method
+  Compression         = 0x10,   //!< Enabled for compressed G-code streaming
 };
 ENUM_FLAGS(SerialFeature);
 
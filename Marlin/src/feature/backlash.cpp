@@ -29,8 +29,13 @@
 #include "../module/motion.h"
 #include "../module/planner.h"
 
-AxisBits Backlash::last_direction_bits;
-xyz_long_t Backlash::residual_error{0};
+#if ENABLED(BACKLASH_IN_STEPPER)
+  xyz_long_t Backlash::takeup_steps{0};
+  hal_timer_t Backlash::takeup_ticks[NUM_AXES];
+#else
+  AxisBits Backlash::last_direction_bits;
+  xyz_long_t Backlash::residual_error{0};
+#endif
 
 #ifdef BACKLASH_DISTANCE_MM
   #if ENABLED(BACKLASH_GCODE)
@@ -54,6 +59,24 @@ xyz_long_t Backlash::residual_error{0};
 
 Backlash backlash;
 
+#if ENABLED(BACKLASH_IN_STEPPER)
+
+/**
+ * The Stepper ISR takes up the backlash with extra steps when an axis
+ * reverses, so planner blocks keep their planned lengths and speeds.
+ * Call this when the backlash or the steps-per-mm change.
+ */
+void Backlash::refresh_takeup() {
+  const float f_corr = float(correction) / all_on;
+  LOOP_NUM_AXES(axis) {
+    const float spm = planner.settings.axis_steps_per_mm[axis];
+    takeup_steps[axis] = f_corr * distance_mm[axis] * spm;
+    takeup_ticks[axis] = _MIN(float(HAL_TIMER_TYPE_MAX), _MAX(1.0f, (STEPPER_TIMER_RATE) / ((BACKLASH_TAKEUP_FEEDRATE) * spm)));
+  }
+}
+
+#else
+
 /**
  * To minimize seams in the printed part, backlash correction only adds
  * steps to the current segment (instead of creating a new segment, which
@@ -182,7 +205,14 @@ int32_t Backlash::get_applied_steps(const AxisEnum axis) {
   return full_error_axis - residual_error_axis;
 }
 
+#endif // !BACKLASH_IN_STEPPER
+
 class Backlash::StepAdjuster {
+  #if ENABLED(BACKLASH_IN_STEPPER)
+    public:
+      // The new take-up applies from the next reversal
+      ~StepAdjuster() { refresh_takeup(); }
+  #else
   private:
     xyz_long_t applied_steps;
   public:
@@ -193,6 +223,7 @@ class Backlash::StepAdjuster {
       // after backlash compensation parameter changes, ensure applied step count does not change
       LOOP_NUM_AXES(axis) residual_error[axis] += backlash.get_applied_steps((AxisEnum)axis) - applied_steps[axis];
     }
+  #endif
 };
 
 #if ENABLED(BACKLASH_GCODE)
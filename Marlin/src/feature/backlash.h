@@ -29,8 +29,10 @@ public:
   static constexpr uint8_t all_on = 0xFF, all_off = 0x00;
 
 private:
-  static AxisBits last_direction_bits;
-  static xyz_long_t residual_error;
+  #if DISABLED(BACKLASH_IN_STEPPER)
+    static AxisBits last_direction_bits;
+    static xyz_long_t residual_error;
+  #endif
 
   #if ENABLED(BACKLASH_GCODE)
     static uint8_t correction;
@@ -72,8 +74,17 @@ public:
     return has_measurement(X_AXIS) || has_measurement(Y_AXIS) || has_measurement(Z_AXIS);
   }
 
-  static void add_correction_steps(const xyze_long_t &dist, const AxisBits dm, block_t * const block);
-  static int32_t get_applied_steps(const AxisEnum axis);
+  #if ENABLED(BACKLASH_IN_STEPPER)
+    static xyz_long_t takeup_steps;             // Steps to take up the backlash on each axis
+    static hal_timer_t takeup_ticks[NUM_AXES];  // Stepper ticks between take-up steps
+    static void refresh_takeup();
+
+    // Take-up steps are made by the Stepper ISR and not counted in its position
+    static constexpr int32_t get_applied_steps(const AxisEnum) { return 0; }
+  #else
+    static void add_correction_steps(const xyze_long_t &dist, const AxisBits dm, block_t * const block);
+    static int32_t get_applied_steps(const AxisEnum axis);
+  #endif
 
   #if ENABLED(BACKLASH_GCODE)
     static void set_correction_uint8(const uint8_t v);
@@ -41,8 +41,15 @@ xy_pos_t LevelingBilinear::grid_spacing,
          LevelingBilinear::grid_start;
 xy_float_t LevelingBilinear::grid_factor;
 bed_mesh_t LevelingBilinear::z_values;
-xy_pos_t LevelingBilinear::cached_rel;
-xy_int8_t LevelingBilinear::cached_g;
+#if ENABLED(ADAPTIVE_PROBING)
+  bed_mesh_t LevelingBilinear::z_spread;
+#endif
+#if ENABLED(MESH_CELL_COEFFICIENTS)
+  mesh_cell_t LevelingBilinear::cells[ABL_CELLS_X][ABL_CELLS_Y];
+#else
+  xy_pos_t LevelingBilinear::cached_rel;
+  xy_int8_t LevelingBilinear::cached_g;
+#endif
 
 /**
  * Extrapolate a single point from its neighbors
@@ -102,6 +109,7 @@ void LevelingBilinear::reset() {
   grid_spacing.reset();
   GRID_LOOP(x, y) {
     z_values[x][y] = NAN;
+    TERN_(ADAPTIVE_PROBING, z_spread[x][y] = NAN);
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, 0));
   }
 }
@@ -158,6 +166,11 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
   SERIAL_ECHOLNPGM("Bilinear Leveling Grid:");
   print_2d_array(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, 3, _z_values ? *_z_values[0] : z_values[0]);
 
+  #if ENABLED(ADAPTIVE_PROBING)
+    SERIAL_ECHOLNPGM("Probe Spread Grid:");
+    print_2d_array(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, 3, z_spread[0]);
+  #endif
+
   #if ENABLED(ABL_BILINEAR_SUBDIVISION)
     if (!_z_values) {
       SERIAL_ECHOLNPGM("Subdivided with CATMULL ROM Leveling Grid:");
@@ -256,13 +269,6 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
 
 #endif // ABL_BILINEAR_SUBDIVISION
 
-// Refresh after other values have been updated
-void LevelingBilinear::refresh_bed_level() {
-  TERN_(ABL_BILINEAR_SUBDIVISION, subdivide_mesh());
-  cached_rel.x = cached_rel.y = -999.999;
-  cached_g.x = cached_g.y = -99;
-}
-
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
   #define ABL_BG_SPACING(A) grid_spacing_virt.A
   #define ABL_BG_FACTOR(A)  grid_factor_virt.A
@@ -277,6 +283,47 @@ void LevelingBilinear::refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
+// Refresh after other values have been updated
+void LevelingBilinear::refresh_bed_level() {
+  TERN_(ABL_BILINEAR_SUBDIVISION, subdivide_mesh());
+  #if ENABLED(MESH_CELL_COEFFICIENTS)
+    for (uint8_t x = 0; x < ABL_CELLS_X; ++x)
+      for (uint8_t y = 0; y < ABL_CELLS_Y; ++y)
+        cells[x][y].set(ABL_BG_GRID(x, y), ABL_BG_GRID(x + 1, y), ABL_BG_GRID(x, y + 1), ABL_BG_GRID(x + 1, y + 1));
+  #else
+    cached_rel.x = cached_rel.y = -999.999;
+    cached_g.x = cached_g.y = -99;
+  #endif
+}
+
+#if ENABLED(MESH_CELL_COEFFICIENTS)
+
+/**
+ * Get the Z adjustment for non-linear bed leveling
+ * from the cell patches built by refresh_bed_level()
+ */
+float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
+
+  // XY relative to the probed area, in (virtual) grid units
+  float u = (raw.x - grid_start.x) * ABL_BG_FACTOR(x),
+        v = (raw.y - grid_start.y) * ABL_BG_FACTOR(y);
+
+  // Cell indices, constrained within bounds. The last cell extrapolates.
+  const float gx = constrain(FLOOR(u), 0, ABL_CELLS_X - 1),
+              gy = constrain(FLOOR(v), 0, ABL_CELLS_Y - 1);
+  u -= gx; v -= gy;
+
+  #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+    // Beyond the grid maintain height at grid edges
+    LIMIT(u, 0, 1);
+    LIMIT(v, 0, 1);
+  #endif
+
+  return cells[uint8_t(gx)][uint8_t(gy)].eval(u, v);
+}
+
+#else
+
 // Get the Z adjustment for non-linear bed leveling
 float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
@@ -361,74 +408,21 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
   return offset;
 }
 
-#if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+#endif // !MESH_CELL_COEFFICIENTS
 
-  #define CELL_INDEX(A,V) ((V - grid_start.A) * ABL_BG_FACTOR(A))
+#if HAS_MESH_LINE_SPLITTING
 
   /**
    * Prepare a bilinear-leveled linear move on Cartesian,
    * splitting the move where it crosses grid borders.
    */
-  void LevelingBilinear::line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits, uint16_t y_splits) {
-    // Get current and destination cells for this line
-    xy_int_t c1 { CELL_INDEX(x, current_position.x), CELL_INDEX(y, current_position.y) },
-             c2 { CELL_INDEX(x, destination.x), CELL_INDEX(y, destination.y) };
-    LIMIT(c1.x, 0, ABL_BG_POINTS_X - 2);
-    LIMIT(c1.y, 0, ABL_BG_POINTS_Y - 2);
-    LIMIT(c2.x, 0, ABL_BG_POINTS_X - 2);
-    LIMIT(c2.y, 0, ABL_BG_POINTS_Y - 2);
-
-    // Start and end in the same cell? No split needed.
-    if (c1 == c2) {
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
-      return;
-    }
-
-    #define LINE_SEGMENT_END(A) (current_position.A + (destination.A - current_position.A) * normalized_dist)
-
-    float normalized_dist;
-    xyze_pos_t end;
-    const xy_int8_t gc { _MAX(c1.x, c2.x), _MAX(c1.y, c2.y) };
-
-    // Crosses on the X and not already split on this X?
-    // The x_splits flags are insurance against rounding errors.
-    if (c2.x != c1.x && TEST(x_splits, gc.x)) {
-      // Split on the X grid line
-      CBI(x_splits, gc.x);
-      end = destination;
-      destination.x = grid_start.x + ABL_BG_SPACING(x) * gc.x;
-      normalized_dist = (destination.x - current_position.x) / (end.x - current_position.x);
-      destination.y = LINE_SEGMENT_END(y);
-    }
-    // Crosses on the Y and not already split on this Y?
-    else if (c2.y != c1.y && TEST(y_splits, gc.y)) {
-      // Split on the Y grid line
-      CBI(y_splits, gc.y);
-      end = destination;
-      destination.y = grid_start.y + ABL_BG_SPACING(y) * gc.y;
-      normalized_dist = (destination.y - current_position.y) / (end.y - current_position.y);
-      destination.x = LINE_SEGMENT_END(x);
-    }
-    else {
-      // Must already have been split on these border(s)
-      // This should be a rare case.
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
-      return;
-    }
-
-    destination.z = LINE_SEGMENT_END(z);
-    destination.e = LINE_SEGMENT_END(e);
-
-    // Do the split and look for more borders
-    line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
-
-    // Restore destination from stack
-    destination = end;
-    line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
+  void LevelingBilinear::line_to_destination(const_feedRate_t scaled_fr_mm_s) {
+    mesh_line_to_destination(scaled_fr_mm_s, grid_start,
+      xy_float_t({ ABL_BG_FACTOR(x), ABL_BG_FACTOR(y) }),
+      xy_uint8_t({ ABL_BG_POINTS_X - 1, ABL_BG_POINTS_Y - 1 })
+    );
   }
 
-#endif // IS_CARTESIAN && !SEGMENT_LEVELED_MOVES
+#endif // HAS_MESH_LINE_SPLITTING
 
 #endif // AUTO_BED_LEVELING_BILINEAR
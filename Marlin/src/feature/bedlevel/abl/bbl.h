@@ -28,10 +28,16 @@ public:
   static bed_mesh_t z_values;
   static xy_pos_t grid_spacing, grid_start;
 
+  #if ENABLED(ADAPTIVE_PROBING)
+    static bed_mesh_t z_spread;   // Spread of the probe readings at each point
+  #endif
+
 private:
   static xy_float_t grid_factor;
-  static xy_pos_t cached_rel;
-  static xy_int8_t cached_g;
+  #if DISABLED(MESH_CELL_COEFFICIENTS)
+    static xy_pos_t cached_rel;
+    static xy_int8_t cached_g;
+  #endif
 
   static void extrapolate_one_point(const uint8_t x, const uint8_t y, const int8_t xdir, const int8_t ydir);
 
@@ -49,6 +55,12 @@ private:
     static void subdivide_mesh();
   #endif
 
+  #if ENABLED(MESH_CELL_COEFFICIENTS)
+    #define ABL_CELLS_X (TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_X, GRID_MAX_POINTS_X) - 1)
+    #define ABL_CELLS_Y (TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_Y, GRID_MAX_POINTS_Y) - 1)
+    static mesh_cell_t cells[ABL_CELLS_X][ABL_CELLS_Y];
+  #endif
+
 public:
   static void reset();
   static void set_grid(const xy_pos_t& _grid_spacing, const xy_pos_t& _grid_start);
@@ -62,8 +74,8 @@ public:
   static float get_z_correction(const xy_pos_t &raw);
   static constexpr float get_z_offset() { return 0.0f; }
 
-  #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
-    static void line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits=0xFFFF, uint16_t y_splits=0xFFFF);
+  #if HAS_MESH_LINE_SPLITTING
+    static void line_to_destination(const_feedRate_t scaled_fr_mm_s);
   #endif
 };
 
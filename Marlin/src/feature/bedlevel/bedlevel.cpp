@@ -27,7 +27,7 @@
 #include "bedlevel.h"
 #include "../../module/planner.h"
 
-#if ANY(MESH_BED_LEVELING, PROBE_MANUALLY)
+#if ANY(MESH_BED_LEVELING, PROBE_MANUALLY, HAS_MESH_LINE_SPLITTING)
   #include "../../module/motion.h"
 #endif
 
@@ -75,6 +75,11 @@ void set_bed_leveling_enabled(const bool enable/*=true*/) {
     _report_leveling();
     planner.synchronize();
 
+    // Bring the mesh cell patches up to date before they are applied
+    #if ENABLED(MESH_CELL_COEFFICIENTS)
+      if (enable) bedlevel.refresh_bed_level();
+    #endif
+
     // Get the corrected leveled / unleveled position
     planner.apply_modifiers(current_position, true);    // Physical position with all modifiers
     planner.leveling_active ^= true;                    // Toggle leveling between apply and unapply
@@ -186,6 +191,30 @@ void reset_bed_level() {
     SERIAL_EOL();
   }
 
+  #if HAS_MESH_LINE_SPLITTING
+
+    /**
+     * Prepare a mesh-leveled linear move in a Cartesian setup,
+     * splitting the move where it crosses mesh lines.
+     * All the pieces are queued in order from a single pass.
+     *
+     * origin - Position of the first mesh line on each axis
+     * factor - Reciprocal of the mesh spacing on each axis
+     * cells  - Number of mesh cells on each axis
+     */
+    void mesh_line_to_destination(const_feedRate_t scaled_fr_mm_s, const xy_pos_t &origin, const xy_float_t &factor, const xy_uint8_t &cells) {
+      const xyze_pos_t start = current_position, dist = destination - start;
+      MeshLineCrossings crossings((xy_pos_t(start) - origin) * factor, (xy_pos_t(destination) - origin) * factor, cells);
+      for (float t; crossings.next(t);) {
+        current_position = start + dist * t;
+        line_to_current_position(scaled_fr_mm_s);
+      }
+      current_position = destination;
+      line_to_current_position(scaled_fr_mm_s);
+    }
+
+  #endif
+
 #endif // AUTO_BED_LEVELING_BILINEAR || MESH_BED_LEVELING
 
 #if ANY(MESH_BED_LEVELING, PROBE_MANUALLY)
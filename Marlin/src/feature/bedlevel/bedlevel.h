@@ -61,6 +61,69 @@ class TemporaryBedLevelingState {
 
   typedef float bed_mesh_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
+  #if ENABLED(MESH_CELL_COEFFICIENTS)
+    /**
+     * Bilinear patch for a single mesh cell: z = a + b*u + c*v + d*u*v
+     * where u and v are the fractional position (0-1) within the cell.
+     * Built when the mesh changes so a correction is just a few multiply-adds.
+     */
+    struct mesh_cell_t {
+      float a, b, c, d;
+      void set(const_float_t z00, const_float_t z10, const_float_t z01, const_float_t z11) {
+        a = z00; b = z10 - z00; c = z01 - z00; d = z11 - z10 - c;
+      }
+      float eval(const_float_t u, const_float_t v) const { return a + v * c + u * (b + v * d); }
+    };
+  #endif
+
+  #if HAS_MESH_LINE_SPLITTING
+
+    /**
+     * Walk a straight XY move across the cells of a regular grid (a 2D DDA)
+     * and yield, in order of travel, the fraction of the move (0 < t < 1)
+     * at each grid line it crosses. A crossing at a cell corner is reported
+     * once. The outer cells extend beyond the grid, so only inner lines count.
+     *
+     * Start and end are given in grid units relative to the first grid line.
+     * Only one division per axis is needed for the whole move.
+     */
+    class MeshLineCrossings {
+      xy_float_t t_next, t_step;  // Fraction of the move at the next line, and between lines
+      xy_uint8_t left;            // Lines still to be crossed on each axis
+
+    public:
+      MeshLineCrossings(const xy_float_t &start, const xy_float_t &end, const xy_uint8_t &cells) {
+        #define _INIT_AXIS(A) do{ \
+          const float d = end.A - start.A, \
+                      c1 = constrain(FLOOR(start.A), 0, cells.A - 1), \
+                      c2 = constrain(FLOOR(end.A), 0, cells.A - 1); \
+          left.A = ABS(c2 - c1); \
+          if (left.A) { \
+            t_step.A = 1.0f / ABS(d); \
+            t_next.A = (c1 + (d > 0) - start.A) / d; \
+          } \
+        }while(0)
+        _INIT_AXIS(x);
+        _INIT_AXIS(y);
+        #undef _INIT_AXIS
+      }
+
+      // Get the next crossing. Return false when the end has been reached.
+      bool next(float &t) {
+        for (;;) {
+          if (!left.x && !left.y) return false;
+          t = !left.y || (left.x && t_next.x < t_next.y) ? t_next.x : t_next.y;
+          // Advance every axis with a line at (or very near) this point, i.e., a corner
+          if (left.x && t_next.x < t + 1e-5f) { t_next.x += t_step.x; left.x--; }
+          if (left.y && t_next.y < t + 1e-5f) { t_next.y += t_step.y; left.y--; }
+          // Skip lines at the very start or end to avoid zero-length moves
+          if (WITHIN(t, 1e-5f, 1.0f - 1e-5f)) return true;
+        }
+      }
+    };
+
+  #endif
+
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
     #include "abl/bbl.h"
   #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -96,4 +159,8 @@ class TemporaryBedLevelingState {
     operator const xy_int8_t&() const { return pos; }
   };
 
+  #if HAS_MESH_LINE_SPLITTING && ANY(AUTO_BED_LEVELING_BILINEAR, MESH_BED_LEVELING)
+    void mesh_line_to_destination(const_feedRate_t scaled_fr_mm_s, const xy_pos_t &origin, const xy_float_t &factor, const xy_uint8_t &cells);
+  #endif
+
 #endif
@@ -55,72 +55,21 @@
     #endif
   }
 
-  #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+  #if HAS_MESH_LINE_SPLITTING
 
     /**
      * Prepare a mesh-leveled linear move in a Cartesian setup,
      * splitting the move where it crosses mesh borders.
      */
-    void mesh_bed_leveling::line_to_destination(const_feedRate_t scaled_fr_mm_s, uint8_t x_splits, uint8_t y_splits) {
-      // Get current and destination cells for this line
-      xy_uint8_t scel = cell_indexes(current_position), ecel = cell_indexes(destination);
-      NOMORE(scel.x, GRID_MAX_CELLS_X - 1);
-      NOMORE(scel.y, GRID_MAX_CELLS_Y - 1);
-      NOMORE(ecel.x, GRID_MAX_CELLS_X - 1);
-      NOMORE(ecel.y, GRID_MAX_CELLS_Y - 1);
-
-      // Start and end in the same cell? No split needed.
-      if (scel == ecel) {
-        current_position = destination;
-        line_to_current_position(scaled_fr_mm_s);
-        return;
-      }
-
-      #define MBL_SEGMENT_END(A) (current_position.A + (destination.A - current_position.A) * normalized_dist)
-
-      float normalized_dist;
-      xyze_pos_t dest;
-      const uint8_t gcx = _MAX(scel.x, ecel.x), gcy = _MAX(scel.y, ecel.y);
-
-      // Crosses on the X and not already split on this X?
-      // The x_splits flags are insurance against rounding errors.
-      if (ecel.x != scel.x && TEST(x_splits, gcx)) {
-        // Split on the X grid line
-        CBI(x_splits, gcx);
-        dest = destination;
-        destination.x = index_to_xpos[gcx];
-        normalized_dist = (destination.x - current_position.x) / (dest.x - current_position.x);
-        destination.y = MBL_SEGMENT_END(y);
-      }
-      // Crosses on the Y and not already split on this Y?
-      else if (ecel.y != scel.y && TEST(y_splits, gcy)) {
-        // Split on the Y grid line
-        CBI(y_splits, gcy);
-        dest = destination;
-        destination.y = index_to_ypos[gcy];
-        normalized_dist = (destination.y - current_position.y) / (dest.y - current_position.y);
-        destination.x = MBL_SEGMENT_END(x);
-      }
-      else {
-        // Must already have been split on these border(s)
-        // This should be a rare case.
-        current_position = destination;
-        line_to_current_position(scaled_fr_mm_s);
-        return;
-      }
-
-      destination.z = MBL_SEGMENT_END(z);
-      destination.e = MBL_SEGMENT_END(e);
-
-      // Do the split and look for more borders
-      line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
-
-      // Restore destination from stack
-      destination = dest;
-      line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
+    void mesh_bed_leveling::line_to_destination(const_feedRate_t scaled_fr_mm_s) {
+      mesh_line_to_destination(scaled_fr_mm_s,
+        xy_pos_t({ MESH_MIN_X, MESH_MIN_Y }),
+        xy_float_t({ RECIPROCAL(MESH_X_DIST), RECIPROCAL(MESH_Y_DIST) }),
+        xy_uint8_t({ GRID_MAX_CELLS_X, GRID_MAX_CELLS_Y })
+      );
     }
 
-  #endif // IS_CARTESIAN && !SEGMENT_LEVELED_MOVES
+  #endif // HAS_MESH_LINE_SPLITTING
 
   void mesh_bed_leveling::report_mesh() {
     SERIAL_ECHOLN(F(STRINGIFY(GRID_MAX_POINTS_X) "x" STRINGIFY(GRID_MAX_POINTS_Y) " mesh. Z offset: "), p_float_t(z_offset, 5), F("\nMeasured points:"));
@@ -117,8 +117,8 @@ public:
     return zf;
   }
 
-  #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
-    static void line_to_destination(const_feedRate_t scaled_fr_mm_s, uint8_t x_splits=0xFF, uint8_t y_splits=0xFF);
+  #if HAS_MESH_LINE_SPLITTING
+    static void line_to_destination(const_feedRate_t scaled_fr_mm_s);
   #endif
 };
 
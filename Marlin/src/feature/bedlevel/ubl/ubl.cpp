@@ -91,6 +91,7 @@ void unified_bed_leveling::reset() {
   set_bed_leveling_enabled(false);
   storage_slot = -1;
   ZERO(z_values);
+  refresh_bed_level();
   #if ENABLED(EXTENSIBLE_UI)
     GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, 0);
   #endif
@@ -107,8 +108,25 @@ void unified_bed_leveling::set_all_mesh_points_to_value(const_float_t value) {
     z_values[x][y] = value;
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, value));
   }
+  refresh_bed_level();
 }
 
+#if ENABLED(MESH_CELL_COEFFICIENTS)
+
+  mesh_cell_t unified_bed_leveling::cells[GRID_MAX_CELLS_X][GRID_MAX_CELLS_Y];
+
+  /**
+   * Rebuild the cell patches used by get_z_correction.
+   * Call this whenever z_values[][] has been altered.
+   */
+  void unified_bed_leveling::refresh_bed_level() {
+    for (uint8_t x = 0; x < GRID_MAX_CELLS_X; ++x)
+      for (uint8_t y = 0; y < GRID_MAX_CELLS_Y; ++y)
+        cells[x][y].set(z_values[x][y], z_values[x + 1][y], z_values[x][y + 1], z_values[x + 1][y + 1]);
+  }
+
+#endif
+
 #if ENABLED(OPTIMIZED_MESH_STORAGE)
 
   constexpr float mesh_store_scaling = 1000;
@@ -76,13 +76,23 @@ private:
 
   static bool G29_parse_parameters() __O0;
   static void shift_mesh_height();
-  static void probe_entire_mesh(const xy_pos_t &near, const bool do_ubl_mesh_map, const bool stow_probe, const bool do_furthest) __O0;
+  static bool probe_invalid_points(const xy_pos_t &near, const bool do_ubl_mesh_map, const bool stow_probe, const bool do_furthest) __O0;
+  #if ENABLED(UBL_ADAPTIVE_PROBING)
+    static bool probe_mesh_adaptive(const xy_pos_t &near, const bool do_ubl_mesh_map, const bool stow_probe, const bool do_furthest) __O0;
+  #endif
+  static void probe_entire_mesh(const xy_pos_t &near, const bool do_ubl_mesh_map, const bool stow_probe, const bool do_furthest
+    OPTARG(UBL_ADAPTIVE_PROBING, const bool adaptive)
+  ) __O0;
   static void tilt_mesh_based_on_probed_grid(const bool do_ubl_mesh_map);
   static bool smart_fill_one(const uint8_t x, const uint8_t y, const int8_t xdir, const int8_t ydir);
   static bool smart_fill_one(const xy_uint8_t &pos, const xy_uint8_t &dir) {
     return smart_fill_one(pos.x, pos.y, dir.x, dir.y);
   }
 
+  #if ENABLED(MESH_CELL_COEFFICIENTS)
+    static mesh_cell_t cells[GRID_MAX_CELLS_X][GRID_MAX_CELLS_Y];
+  #endif
+
   #if ENABLED(UBL_DEVEL_DEBUGGING)
     static void g29_what_command();
     static void g29_eeprom_dump();
@@ -106,6 +116,12 @@ public:
   static bool sanity_check();
   static void smart_fill_mesh();
 
+  #if ENABLED(MESH_CELL_COEFFICIENTS)
+    static void refresh_bed_level();
+  #else
+    static void refresh_bed_level() {}
+  #endif
+
   static void G29() __O0;                           // O0 for no optimization
   static void smart_fill_wlsf(const_float_t ) __O2; // O2 gives smaller code than Os on A2560
 
@@ -252,7 +268,6 @@ public:
    * on the Y position within the cell.
    */
   static float get_z_correction(const_float_t rx0, const_float_t ry0) {
-    const int8_t cx = cell_index_x(rx0), cy = cell_index_y(ry0); // return values are clamped
 
     /**
      * Check if the requested location is off the mesh.  If so, and
@@ -263,11 +278,26 @@ public:
         return UBL_Z_RAISE_WHEN_OFF_MESH;
     #endif
 
-    const uint8_t mx = _MIN(cx, (GRID_MAX_POINTS_X) - 2) + 1, my = _MIN(cy, (GRID_MAX_POINTS_Y) - 2) + 1;
-    const float x0 = get_mesh_x(cx), x1 = get_mesh_x(cx + 1),
-                z1 = calc_z0(rx0, x0, z_values[cx][cy], x1, z_values[mx][cy]),
-                z2 = calc_z0(rx0, x0, z_values[cx][my], x1, z_values[mx][my]);
-    float z0 = calc_z0(ry0, get_mesh_y(cy), z1, get_mesh_y(cy + 1), z2);
+    #if ENABLED(MESH_CELL_COEFFICIENTS)
+
+      // Position in cell units, then the clamped cell and the ratio within it.
+      // The outer cells extrapolate, as with the interpolation below.
+      const float gx = (rx0 - (MESH_MIN_X)) * RECIPROCAL(MESH_X_DIST),
+                  gy = (ry0 - (MESH_MIN_Y)) * RECIPROCAL(MESH_Y_DIST);
+      const uint8_t cx = constrain(FLOOR(gx), 0, GRID_MAX_CELLS_X - 1),
+                    cy = constrain(FLOOR(gy), 0, GRID_MAX_CELLS_Y - 1);
+      float z0 = cells[cx][cy].eval(gx - cx, gy - cy);
+
+    #else
+
+      const int8_t cx = cell_index_x(rx0), cy = cell_index_y(ry0); // return values are clamped
+      const uint8_t mx = _MIN(cx, (GRID_MAX_POINTS_X) - 2) + 1, my = _MIN(cy, (GRID_MAX_POINTS_Y) - 2) + 1;
+      const float x0 = get_mesh_x(cx), x1 = get_mesh_x(cx + 1),
+                  z1 = calc_z0(rx0, x0, z_values[cx][cy], x1, z_values[mx][cy]),
+                  z2 = calc_z0(rx0, x0, z_values[cx][my], x1, z_values[mx][my]);
+      float z0 = calc_z0(ry0, get_mesh_y(cy), z1, get_mesh_y(cy + 1), z2);
+
+    #endif
 
     if (isnan(z0)) { // If part of the Mesh is undefined, it will show up as NAN
       z0 = 0.0;      // in z_values[][] and propagate through the calculations.
@@ -149,6 +149,10 @@
  *
  *                    Use 'T' (Topology) to generate a report of mesh generation.
  *
+ *                    With UBL_ADAPTIVE_PROBING (and without 'C') a coarse grid is probed first. Only the cells
+ *                    where the coarse grid shows curvature are probed in full. The rest are interpolated.
+ *                    To probe every point use 'G29 I999' followed by 'G29 P1 C'.
+ *
  *                    P1 will suspend Mesh generation if the controller button is held down. Note that you may need
  *                    to press and hold the switch for several seconds if moves are underway.
  *
@@ -473,7 +477,7 @@ void unified_bed_leveling::G29() {
           }
           if (param.V_verbosity > 1)
             SERIAL_ECHOLN(F("Probing around ("), param.XY_pos.x, C(','), param.XY_pos.y, F(").\n"));
-          probe_entire_mesh(param.XY_pos, parser.seen_test('T'), parser.seen_test('E'), parser.seen_test('U'));
+          probe_entire_mesh(param.XY_pos, parser.seen_test('T'), parser.seen_test('E'), parser.seen_test('U') OPTARG(UBL_ADAPTIVE_PROBING, !parser.seen_test('C')));
 
           report_current_position();
           SET_PROBE_DEPLOYED(true);
@@ -753,28 +757,29 @@ void unified_bed_leveling::shift_mesh_height() {
 }
 
 #if HAS_BED_PROBE
-  /**
-   * G29 P1 T<maptype> V<verbosity> : Probe Entire Mesh
-   *   Probe all invalidated locations of the mesh that can be reached by the probe.
-   *   This attempts to fill in locations closest to the nozzle's start location first.
-   */
-  void unified_bed_leveling::probe_entire_mesh(const xy_pos_t &nearby, const bool do_ubl_mesh_map, const bool stow_probe, const bool do_furthest) {
-    probe.deploy(); // Deploy before ui.capture() to allow for PAUSE_BEFORE_DEPLOY_STOW
 
-    TERN_(HAS_MARLINUI_MENU, ui.capture());
-    TERN_(EXTENSIBLE_UI, ExtUI::onLevelingStart());
+  #ifndef HUGE_VALF
+    #define HUGE_VALF __FLT_MAX__
+  #endif
 
-    save_ubl_active_state_and_disable();  // No bed level correction so only raw data is obtained
-    grid_count_t count = GRID_MAX_POINTS;
+  /**
+   * Probe the invalid mesh points that can be reached by the probe, closest first.
+   * Points marked with HUGE_VALF are skipped. Points that fail to probe are also
+   * marked with HUGE_VALF so they won't be tried again.
+   * Return false if the user aborted.
+   */
+  bool unified_bed_leveling::probe_invalid_points(const xy_pos_t &nearby, const bool do_ubl_mesh_map, const bool stow_probe, const bool do_furthest) {
+    grid_count_t total = 0;
+    GRID_LOOP(x, y) if (isnan(z_values[x][y])) total++;
+    grid_count_t count = total;
 
     mesh_index_pair best;
-    TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_START));
     do {
       if (do_ubl_mesh_map) display_map(param.T_map_type);
 
-      const grid_count_t point_num = (GRID_MAX_POINTS - count) + 1;
-      SERIAL_ECHOLNPGM("Probing mesh point ", point_num, "/", GRID_MAX_POINTS, ".");
-      TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT_F(MSG_PROBING_POINT), point_num, int(GRID_MAX_POINTS)));
+      const grid_count_t point_num = (total - count) + 1;
+      SERIAL_ECHOLNPGM("Probing mesh point ", point_num, "/", total, ".");
+      TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT_F(MSG_PROBING_POINT), point_num, int(total)));
       TERN_(HAS_BACKLIGHT_TIMEOUT, ui.refresh_backlight_timeout());
 
       #if HAS_MARLINUI_MENU
@@ -784,15 +789,10 @@ void unified_bed_leveling::shift_mesh_height() {
           ui.wait_for_release();
           ui.quick_feedback();
           ui.release();
-          probe.stow(); // Release UI before stow to allow for PAUSE_BEFORE_DEPLOY_STOW
-          return restore_ubl_active_state();
+          return false;
         }
       #endif
 
-      #ifndef HUGE_VALF
-        #define HUGE_VALF __FLT_MAX__
-      #endif
-
       best = do_furthest // Points with valid data or HUGE_VALF are skipped
         ? find_furthest_invalid_mesh_point()
         : find_closest_mesh_point_of_type(INVALID, nearby, true);
@@ -810,9 +810,137 @@ void unified_bed_leveling::shift_mesh_height() {
 
     } while (best.pos.x >= 0 && --count);
 
+    return true;
+  }
+
+  #if ENABLED(UBL_ADAPTIVE_PROBING)
+
+    /**
+     * Probe a coarse grid with every UBL_ADAPTIVE_STRIDE mesh line (plus the last line)
+     * and fit a plane to the coarse points around each coarse cell. Where a point strays
+     * from the plane by more than UBL_ADAPTIVE_TOLERANCE the bed is curved, so probe all
+     * the points in that cell. Fill the remaining cells by bilinear interpolation.
+     * Return false if the user aborted.
+     */
+    bool unified_bed_leveling::probe_mesh_adaptive(const xy_pos_t &nearby, const bool do_ubl_mesh_map, const bool stow_probe, const bool do_furthest) {
+      constexpr uint8_t S = UBL_ADAPTIVE_STRIDE;
+      constexpr xy_uint8_t cells = { ((GRID_MAX_POINTS_X) - 2) / S + 1, ((GRID_MAX_POINTS_Y) - 2) / S + 1 };
+
+      // Mesh index of a coarse grid line
+      auto mesh_x = [](const uint8_t c) { return uint8_t(_MIN(c * S, (GRID_MAX_POINTS_X) - 1)); };
+      auto mesh_y = [](const uint8_t c) { return uint8_t(_MIN(c * S, (GRID_MAX_POINTS_Y) - 1)); };
+      auto on_coarse_line = [](const uint8_t i, const uint8_t n) { return i % S == 0 || i == n - 1; };
+
+      auto clear_marks = []{ GRID_LOOP(x, y) if (z_values[x][y] == HUGE_VALF) z_values[x][y] = NAN; };
+
+      // Probe the coarse grid
+      GRID_LOOP(x, y)
+        if (!on_coarse_line(x, GRID_MAX_POINTS_X) || !on_coarse_line(y, GRID_MAX_POINTS_Y))
+          z_values[x][y] = HUGE_VALF;
+      if (!probe_invalid_points(nearby, do_ubl_mesh_map, stow_probe, do_furthest)) return false;
+      clear_marks();
+
+      // Find the flat cells, marked by their first point
+      MeshFlags flat, needed;
+      flat.reset();
+      needed.reset();
+      grid_count_t curved = 0;
+      for (uint8_t cx = 0; cx < cells.x; ++cx) for (uint8_t cy = 0; cy < cells.y; ++cy) {
+        // Gather the valid coarse points in and around the cell
+        xyz_pos_t pts[16];
+        uint8_t n = 0;
+        bool corners_valid = true;
+        for (int16_t i = cx - 1; i <= cx + 2; ++i) for (int16_t j = cy - 1; j <= cy + 2; ++j) {
+          if (!WITHIN(i, 0, cells.x) || !WITHIN(j, 0, cells.y)) continue;
+          const uint8_t mx = mesh_x(i), my = mesh_y(j);
+          if (isnan(z_values[mx][my])) {
+            if (WITHIN(i, cx, cx + 1) && WITHIN(j, cy, cy + 1)) corners_valid = false;
+            continue;
+          }
+          pts[n++].set(get_mesh_x(mx), get_mesh_y(my), z_values[mx][my]);
+        }
+
+        bool is_flat = false;
+        if (corners_valid) {
+          linear_fit_data lsf_results;
+          incremental_LSF_reset(&lsf_results);
+          for (uint8_t k = 0; k < n; ++k) incremental_LSF(&lsf_results, pts[k].x, pts[k].y, pts[k].z);
+          if (!finish_incremental_LSF(&lsf_results)) {
+            float deviation = 0;
+            for (uint8_t k = 0; k < n; ++k)
+              NOLESS(deviation, ABS(pts[k].z + lsf_results.A * pts[k].x + lsf_results.B * pts[k].y + lsf_results.D));
+            is_flat = deviation <= (UBL_ADAPTIVE_TOLERANCE);
+          }
+        }
+
+        const uint8_t x0 = mesh_x(cx), x1 = mesh_x(cx + 1), y0 = mesh_y(cy), y1 = mesh_y(cy + 1);
+        if (is_flat)
+          flat.mark(x0, y0);
+        else {
+          curved++;
+          for (uint8_t x = x0; x <= x1; ++x) for (uint8_t y = y0; y <= y1; ++y) needed.mark(x, y);
+        }
+      }
+
+      SERIAL_ECHOLNPGM("Probing ", curved, " of ", cells.x * cells.y, " mesh cells in full.");
+
+      // Probe the points in the curved cells
+      GRID_LOOP(x, y) if (!needed.marked(x, y) && isnan(z_values[x][y])) z_values[x][y] = HUGE_VALF;
+      if (!probe_invalid_points(nearby, do_ubl_mesh_map, stow_probe, do_furthest)) return false;
+      clear_marks();
+
+      // Interpolate the rest of the points in the flat cells
+      for (uint8_t cx = 0; cx < cells.x; ++cx) for (uint8_t cy = 0; cy < cells.y; ++cy) {
+        const uint8_t x0 = mesh_x(cx), x1 = mesh_x(cx + 1), y0 = mesh_y(cy), y1 = mesh_y(cy + 1);
+        if (!flat.marked(x0, y0)) continue;
+        const float z00 = z_values[x0][y0], z10 = z_values[x1][y0],
+                    z01 = z_values[x0][y1], z11 = z_values[x1][y1];
+        for (uint8_t x = x0; x <= x1; ++x) for (uint8_t y = y0; y <= y1; ++y) {
+          if (!isnan(z_values[x][y])) continue;
+          const float u = float(x - x0) / (x1 - x0), v = float(y - y0) / (y1 - y0);
+          z_values[x][y] = z00 + u * (z10 - z00) + v * (z01 - z00 + u * (z11 - z01 - z10 + z00));
+          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z_values[x][y]));
+        }
+      }
+
+      return true;
+    }
+
+  #endif // UBL_ADAPTIVE_PROBING
+
+  /**
+   * G29 P1 T<maptype> V<verbosity> : Probe Entire Mesh
+   *   Probe all invalidated locations of the mesh that can be reached by the probe.
+   *   This attempts to fill in locations closest to the nozzle's start location first.
+   */
+  void unified_bed_leveling::probe_entire_mesh(const xy_pos_t &nearby, const bool do_ubl_mesh_map, const bool stow_probe, const bool do_furthest
+    OPTARG(UBL_ADAPTIVE_PROBING, const bool adaptive)
+  ) {
+    probe.deploy(); // Deploy before ui.capture() to allow for PAUSE_BEFORE_DEPLOY_STOW
+
+    TERN_(HAS_MARLINUI_MENU, ui.capture());
+    TERN_(EXTENSIBLE_UI, ExtUI::onLevelingStart());
+
+    save_ubl_active_state_and_disable();  // No bed level correction so only raw data is obtained
+
+    TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(-1, -1, ExtUI::G29_START));
+
+    bool completed;
+    #if ENABLED(UBL_ADAPTIVE_PROBING)
+      if (adaptive)
+        completed = probe_mesh_adaptive(nearby, do_ubl_mesh_map, stow_probe, do_furthest);
+      else
+    #endif
+        completed = probe_invalid_points(nearby, do_ubl_mesh_map, stow_probe, do_furthest);
+
+    if (!completed) {
+      probe.stow(); // Release UI before stow to allow for PAUSE_BEFORE_DEPLOY_STOW
+      return restore_ubl_active_state();
+    }
+
     GRID_LOOP(x, y) if (z_values[x][y] == HUGE_VALF) z_values[x][y] = NAN; // Restore NAN for HUGE_VALF marks
 
-    TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_FINISH));
+    TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(-1, -1, ExtUI::G29_FINISH));
 
     // Release UI during stow to allow for PAUSE_BEFORE_DEPLOY_STOW
     TERN_(HAS_MARLINUI_MENU, ui.release());
@@ -25,10 +25,10 @@
 
 #define BINARY_STREAM_COMPRESSION
 #if ENABLED(BINARY_STREAM_COMPRESSION)
-  #include "../libs/heatshrink/heatshrink_decoder.h"
+  #include "../libs/heatshrink/heatshrink_stream.h"
   // STM32 (and others?) require a word-aligned buffer for SD card transfers via DMA
   static __attribute__((aligned(sizeof(size_t)))) uint8_t decode_buffer[512] = {};
-  static heatshrink_decoder hsd;
+  static HeatshrinkStream unpacker;
 #endif
 
 inline bool bs_serial_data_available(const serial_index_t index) {
@@ -67,30 +67,22 @@ private:
     }
     transfer_active = true;
     data_waiting = 0;
-    TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_reset(&hsd));
+    TERN_(BINARY_STREAM_COMPRESSION, unpacker.reset());
     return true;
   }
 
   static bool file_write(char *buffer, const size_t length) {
     #if ENABLED(BINARY_STREAM_COMPRESSION)
       if (compression) {
-        size_t total_processed = 0, processed_count = 0;
-        HSD_poll_res presult;
-
-        while (total_processed < length) {
-          heatshrink_decoder_sink(&hsd, reinterpret_cast<uint8_t*>(&buffer[total_processed]), length - total_processed, &processed_count);
-          total_processed += processed_count;
-          do {
-            presult = heatshrink_decoder_poll(&hsd, &decode_buffer[data_waiting], sizeof(decode_buffer) - data_waiting, &processed_count);
-            data_waiting += processed_count;
-            if (data_waiting == sizeof(decode_buffer)) {
-              if (!dummy_transfer)
-                if (card.write(decode_buffer, data_waiting) < 0) {
-                  return false;
-                }
-              data_waiting = 0;
-            }
-          } while (presult == HSDR_POLL_MORE);
+        for (size_t total_processed = 0; total_processed < length;) {
+          total_processed += unpacker.sink(reinterpret_cast<uint8_t*>(&buffer[total_processed]), length - total_processed);
+          // Write out each full buffer of decoded data
+          for (;;) {
+            data_waiting += unpacker.poll(&decode_buffer[data_waiting], sizeof(decode_buffer) - data_waiting);
+            if (data_waiting < sizeof(decode_buffer)) break;
+            if (!dummy_transfer && card.write(decode_buffer, data_waiting) < 0) return false;
+            data_waiting = 0;
+          }
         }
         return true;
       }
@@ -110,7 +102,7 @@ private:
       card.closefile();
       card.release();
     }
-    TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_finish(&hsd));
+    TERN_(BINARY_STREAM_COMPRESSION, unpacker.finish());
     transfer_active = false;
     return true;
   }
@@ -120,7 +112,7 @@ private:
       card.closefile();
       card.removeFile(card.filename);
       card.release();
-      TERN_(BINARY_STREAM_COMPRESSION, heatshrink_decoder_finish(&hsd));
+      TERN_(BINARY_STREAM_COMPRESSION, unpacker.finish());
     }
     transfer_active = false;
     return;
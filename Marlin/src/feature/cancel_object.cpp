@@ -34,9 +34,9 @@ cancel_state_t CancelObject::state;
 
 void CancelObject::set_active_object(const int8_t obj) {
   state.active_object = obj;
-  if (WITHIN(obj, 0, 31)) {
+  if (state.valid(obj)) {
     if (obj >= state.object_count) state.object_count = obj + 1;
-    state.skipping = TEST(state.canceled, obj);
+    state.skipping = state.is_canceled(obj);
   }
   else
     state.skipping = false;
@@ -50,15 +50,15 @@ void CancelObject::set_active_object(const int8_t obj) {
 }
 
 void CancelObject::cancel_object(const int8_t obj) {
-  if (WITHIN(obj, 0, 31)) {
-    SBI(state.canceled, obj);
+  if (state.valid(obj)) {
+    SBI(state.canceled[obj >> 3], obj & 7);
     if (obj == state.active_object) state.skipping = true;
   }
 }
 
 void CancelObject::uncancel_object(const int8_t obj) {
-  if (WITHIN(obj, 0, 31)) {
-    CBI(state.canceled, obj);
+  if (state.valid(obj)) {
+    CBI(state.canceled[obj >> 3], obj & 7);
     if (obj == state.active_object) state.skipping = false;
   }
 }
@@ -67,12 +67,12 @@ void CancelObject::report() {
   if (state.active_object >= 0)
     SERIAL_ECHO_MSG("Active Object: ", state.active_object);
 
-  if (state.canceled == 0x0000) return;
+  if (!state.any_canceled()) return;
 
   SERIAL_ECHO_START();
   SERIAL_ECHOPGM("Canceled:");
   for (int i = 0; i < state.object_count; i++)
-    if (TEST(state.canceled, i)) { SERIAL_CHAR(' '); SERIAL_ECHO(i); }
+    if (state.is_canceled(i)) { SERIAL_CHAR(' '); SERIAL_ECHO(i); }
   SERIAL_EOL();
 }
 
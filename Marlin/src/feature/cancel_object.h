@@ -21,12 +21,16 @@
  */
 #pragma once
 
-#include <stdint.h>
+#include "../inc/MarlinConfigPre.h"
 
 typedef struct CancelState {
   bool skipping = false;
   int8_t object_count = 0, active_object = 0;
-  uint32_t canceled = 0x0000;
+  uint8_t canceled[(CANCEL_OBJECTS_MAX + 7) / 8] = { 0 }; // One bit per object
+
+  static bool valid(const int8_t obj) { return WITHIN(obj, 0, CANCEL_OBJECTS_MAX - 1); }
+  bool is_canceled(const int8_t obj) const { return valid(obj) && TEST(canceled[obj >> 3], obj & 7); }
+  bool any_canceled() const { for (const uint8_t b : canceled) if (b) return true; return false; }
 } cancel_state_t;
 
 class CancelObject {
@@ -36,10 +40,10 @@ public:
   static void cancel_object(const int8_t obj);
   static void uncancel_object(const int8_t obj);
   static void report();
-  static bool is_canceled(const int8_t obj) { return TEST(state.canceled, obj); }
+  static bool is_canceled(const int8_t obj) { return state.is_canceled(obj); }
   static void clear_active_object() { set_active_object(-1); }
   static void cancel_active_object() { cancel_object(state.active_object); }
-  static void reset() { state.canceled = 0x0000; state.object_count = 0; clear_active_object(); }
+  static void reset() { ZERO(state.canceled); state.object_count = 0; clear_active_object(); }
 };
 
 extern CancelObject cancelable;
@@ -28,11 +28,11 @@
 
 #include "../MarlinCore.h"
 
-#define CHECK_PAGE(I, R) do{                                \
-  if (I >= sizeof(page_states) / sizeof(page_states[0])) {  \
-    fatal_error = true;                                     \
-    return R;                                               \
-  }                                                         \
+#define CHECK_PAGE(I, R) do{ \
+  if (I >= active_pages) {   \
+    fatal_error = true;      \
+    return R;                \
+  }                          \
 }while(0)
 
 #define CHECK_PAGE_STATE(I, R, S) do { \
@@ -51,6 +51,31 @@ namespace DirectStepping {
   template<typename Cfg>
   volatile bool SerialPageManager<Cfg>::fatal_error;
 
+  template<typename Cfg>
+  uint16_t SerialPageManager<Cfg>::active_pages;
+
+  #if ENABLED(DIRECT_STEPPING_MAIN_RX)
+    template<typename Cfg>
+    serial_index_t SerialPageManager<Cfg>::rx_port;
+  #endif
+
+  #if ENABLED(DIRECT_STEPPING_COMPRESSION)
+    template<typename Cfg>
+    heatshrink_decoder SerialPageManager<Cfg>::hsd;
+
+    template<typename Cfg>
+    uint16_t SerialPageManager<Cfg>::packed_size;
+
+    template<typename Cfg>
+    uint16_t SerialPageManager<Cfg>::unpacked_size;
+
+    template<typename Cfg>
+    bool SerialPageManager<Cfg>::packed;
+
+    template<typename Cfg>
+    bool SerialPageManager<Cfg>::unpack_error;
+  #endif
+
   template<typename Cfg>
   volatile PageState SerialPageManager<Cfg>::page_states[Cfg::PAGE_COUNT];
 
@@ -77,6 +102,7 @@ namespace DirectStepping {
     for (int i = 0 ; i < Cfg::PAGE_COUNT ; i++)
       page_states[i] = PageState::FREE;
 
+    active_pages = Cfg::PAGE_COUNT;
     fatal_error = false;
     state = State::NEWLINE;
 
@@ -85,6 +111,16 @@ namespace DirectStepping {
     SERIAL_ECHOLNPGM("pages_ready");
   }
 
+  template <typename Cfg>
+  bool SerialPageManager<Cfg>::set_page_count(const uint16_t count) {
+    if (!WITHIN(count, 1, Cfg::PAGE_COUNT)) return false;
+    for (uint16_t i = 0; i < active_pages; ++i)
+      if (page_states[i] != PageState::FREE) return false;
+    active_pages = count;
+    page_states_dirty = true;
+    return true;
+  }
+
   template<typename Cfg>
   FORCE_INLINE bool SerialPageManager<Cfg>::maybe_store_rxd_char(uint8_t c) {
     switch (state) {
@@ -101,7 +137,14 @@ namespace DirectStepping {
         switch (c) {
           case Cfg::CONTROL_CHAR:
             state = State::ADDRESS;
+            TERN_(DIRECT_STEPPING_COMPRESSION, packed = false);
             return true;
+          #if ENABLED(DIRECT_STEPPING_COMPRESSION)
+            case Cfg::PACKED_CHAR:
+              state = State::ADDRESS;
+              packed = true;
+              return true;
+          #endif
           case '\n':
           case '\r':
             state = State::NEWLINE;
@@ -126,9 +169,40 @@ namespace DirectStepping {
 
         set_page_state(write_page_idx, PageState::WRITING);
 
+        #if ENABLED(DIRECT_STEPPING_COMPRESSION)
+          if (packed) {
+            state = State::PACKED_SIZE;
+            return true;
+          }
+        #endif
+
         state = Cfg::DIRECTIONAL ? State::COLLECT : State::SIZE;
 
         return true;
+      #if ENABLED(DIRECT_STEPPING_COMPRESSION)
+        case State::PACKED_SIZE:
+          packed_size = c;
+          state = State::PACKED_SIZE2;
+          return true;
+        case State::PACKED_SIZE2:
+          packed_size |= uint16_t(c) << 8;
+          unpacked_size = 0;
+          unpack_error = !packed_size;
+          heatshrink_decoder_reset(&hsd);
+          state = packed_size ? State::PACKED_COLLECT : State::CHECKSUM;
+          return true;
+        case State::PACKED_COLLECT: {
+          checksum ^= c;
+          size_t sunk;
+          if (heatshrink_decoder_sink(&hsd, &c, 1, &sunk) != HSDR_SINK_OK) unpack_error = true;
+          if (!--packed_size) {
+            heatshrink_decoder_finish(&hsd);
+            state = State::CHECKSUM;
+          }
+          unpack();
+          return true;
+        }
+      #endif
       case State::SIZE:
         // Zero means full page size
         write_page_size = c;
@@ -157,7 +231,13 @@ namespace DirectStepping {
         state = State::CHECKSUM;
         return true;
       case State::CHECKSUM: {
-        const PageState page_state = (checksum == c) ? PageState::OK : PageState::FAIL;
+        bool good = (checksum == c);
+        #if ENABLED(DIRECT_STEPPING_COMPRESSION)
+          // A packed page must fit, and fill the page if the format has no size
+          if (packed)
+            good = good && !unpack_error && unpacked_size && (!Cfg::DIRECTIONAL || unpacked_size == Cfg::PAGE_SIZE);
+        #endif
+        const PageState page_state = good ? PageState::OK : PageState::FAIL;
         set_page_state(write_page_idx, page_state);
         state = State::MONITOR;
         return true;
@@ -172,6 +252,57 @@ namespace DirectStepping {
     }
   }
 
+  #if ENABLED(DIRECT_STEPPING_COMPRESSION)
+
+    /**
+     * Decode all available output into the page being written.
+     * More output than the page can hold is an error.
+     */
+    template <typename Cfg>
+    void SerialPageManager<Cfg>::unpack() {
+      size_t count;
+      while (unpacked_size < Cfg::PAGE_SIZE) {
+        const size_t room = Cfg::PAGE_SIZE - unpacked_size;
+        const HSD_poll_res res = heatshrink_decoder_poll(&hsd, &pages[write_page_idx][unpacked_size], room, &count);
+        unpacked_size += count;
+        if (res != HSDR_POLL_MORE) return;
+      }
+      // The page is full. Poll reports MORE for a full buffer, so look for an extra byte.
+      uint8_t extra;
+      heatshrink_decoder_poll(&hsd, &extra, 1, &count);
+      if (count) unpack_error = true;
+    }
+
+  #endif
+
+  #if ENABLED(DIRECT_STEPPING_MAIN_RX)
+
+    template <typename Cfg>
+    bool SerialPageManager<Cfg>::receive(const serial_index_t port, const uint8_t c) {
+      if (!maybe_store_rxd_char(c)) return false;
+      rx_port = port;
+      receive_bulk(port);
+      return true;
+    }
+
+    /**
+     * Read page bytes in a tight loop, without going through the command parser.
+     * Called for each port before the command queue is checked, so a page keeps
+     * coming in even when the queue is full.
+     */
+    template <typename Cfg>
+    void SerialPageManager<Cfg>::receive_bulk(const serial_index_t port) {
+      if (state <= State::NEWLINE || port.index != rx_port.index) return;
+      while (SERIAL_IMPL.available(port)) {
+        const int c = SERIAL_IMPL.read(port);
+        if (c < 0) break;
+        maybe_store_rxd_char(c);
+        if (state == State::MONITOR) break; // Page done
+      }
+    }
+
+  #endif
+
   template <typename Cfg>
   void SerialPageManager<Cfg>::write_responses() {
     if (fatal_error) {
@@ -184,15 +315,15 @@ namespace DirectStepping {
 
     SERIAL_CHAR(Cfg::CONTROL_CHAR);
     constexpr int state_bits = 2;
-    constexpr int n_bytes = Cfg::PAGE_COUNT >> state_bits;
-    volatile uint8_t bits_b[n_bytes] = { 0 };
+    const uint16_t n_bytes = (active_pages + 3) >> state_bits;
+    volatile uint8_t bits_b[Cfg::PAGE_COUNT >> state_bits] = { 0 };
 
-    for (page_idx_t i = 0 ; i < Cfg::PAGE_COUNT ; i++) {
+    for (uint16_t i = 0 ; i < active_pages ; i++) {
       bits_b[i >> state_bits] |= page_states[i] << ((i * state_bits) & 0x7);
     }
 
     uint8_t crc = 0;
-    for (uint8_t i = 0 ; i < n_bytes ; i++) {
+    for (uint16_t i = 0 ; i < n_bytes ; i++) {
       crc ^= bits_b[i];
       SERIAL_CHAR(bits_b[i]);
     }
@@ -23,10 +23,29 @@
 
 #include "../inc/MarlinConfig.h"
 
+#if ENABLED(DIRECT_STEPPING_COMPRESSION)
+  #include "../libs/heatshrink/heatshrink_decoder.h"
+#endif
+
+/**
+ * Pages are sent as a control character, a page index, (a size byte,)
+ * the page data, and an XOR checksum of the data.
+ *
+ * With DIRECT_STEPPING_COMPRESSION a page may also be sent as PACKED_CHAR,
+ * a page index, a 16-bit (LSB first) size, heatshrink-compressed data,
+ * and an XOR checksum of the compressed data.
+ *
+ * On AVR pages are taken from the serial RX ISR. Elsewhere they're taken
+ * from the main loop, with the rest of a page read in bulk once it starts.
+ */
+
 namespace DirectStepping {
 
   enum State : char {
     MONITOR, NEWLINE, ADDRESS, SIZE, COLLECT, CHECKSUM, UNFAIL
+    #if ENABLED(DIRECT_STEPPING_COMPRESSION)
+      , PACKED_SIZE, PACKED_SIZE2, PACKED_COLLECT
+    #endif
   };
 
   enum PageState : uint8_t {
@@ -56,6 +75,19 @@ namespace DirectStepping {
     static bool maybe_store_rxd_char(uint8_t c);
     static void write_responses();
 
+    #if ENABLED(DIRECT_STEPPING_MAIN_RX)
+      // Take a character read by the main loop. Return true if it's page data.
+      static bool receive(const serial_index_t port, const uint8_t c);
+      // Read the rest of a page in progress, if it came from this port
+      static void receive_bulk(const serial_index_t port);
+    #endif
+
+    // Pages in use, set by the host (G6 P) while all pages are free
+    static uint16_t page_count() { return active_pages; }
+    static bool set_page_count(const uint16_t count);
+
+    static PageState get_page_state(const page_idx_t page_idx) { return page_states[page_idx]; }
+
     // common methods for page managers
     static void init();
     static uint8_t *get_page(const page_idx_t page_idx);
@@ -67,6 +99,18 @@ namespace DirectStepping {
 
     static State state;
     static volatile bool fatal_error;
+    static uint16_t active_pages;
+
+    #if ENABLED(DIRECT_STEPPING_MAIN_RX)
+      static serial_index_t rx_port;
+    #endif
+
+    #if ENABLED(DIRECT_STEPPING_COMPRESSION)
+      static heatshrink_decoder hsd;
+      static uint16_t packed_size, unpacked_size;
+      static bool packed, unpack_error;
+      static void unpack();
+    #endif
 
     static volatile PageState page_states[Cfg::PAGE_COUNT];
     static volatile bool page_states_dirty;
@@ -83,6 +127,7 @@ namespace DirectStepping {
   template <int num_pages, int num_axes, int bits_segment, bool dir, int segments>
   struct config_t {
     static constexpr char CONTROL_CHAR  = '!';
+    static constexpr char PACKED_CHAR   = '#';
 
     static constexpr int PAGE_COUNT     = num_pages;
     static constexpr int AXIS_COUNT     = num_axes;
@@ -99,13 +144,13 @@ namespace DirectStepping {
     typedef uvalue_t(PAGE_COUNT - 1) page_idx_t;
   };
 
-  template <uint8_t num_pages>
+  template <int num_pages>
   using SP_4x4D_128 = config_t<num_pages, 4, 4, true,  128>;
 
-  template <uint8_t num_pages>
+  template <int num_pages>
   using SP_4x2_256  = config_t<num_pages, 4, 2, false, 256>;
 
-  template <uint8_t num_pages>
+  template <int num_pages>
   using SP_4x1_512  = config_t<num_pages, 4, 1, false, 512>;
 
   // configured types
@@ -0,0 +1,155 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(FILWIDTH_FLOW_COMPENSATION)
+
+#include "flowcomp.h"
+#include "filwidth.h"
+#include "../module/stepper.h"
+
+FlowCompensation flowcomp;
+
+FlowCompensation::width_t FlowCompensation::widths[SEGMENTS];
+float FlowCompensation::planned_mm; // = 0
+volatile int32_t FlowCompensation::fed_steps; // = 0
+uint32_t FlowCompensation::samples; // = 0
+float FlowCompensation::err_sum, FlowCompensation::err_sq, FlowCompensation::err_max, // = 0
+      FlowCompensation::factor_min = 1.0f, FlowCompensation::factor_max = 1.0f;
+
+#if HAS_FLOWCOMP_ENCODER
+  float FlowCompensation::slip = 1.0f;
+  uint16_t FlowCompensation::edges;
+  float FlowCompensation::window_mm;
+#endif
+
+void FlowCompensation::reset() {
+  for (uint8_t i = 0; i < SEGMENTS; ++i) widths[i].um = 0;
+  #if HAS_FLOWCOMP_ENCODER
+    slip = 1.0f;
+    edges = 0;
+    window_mm = fed_mm();
+  #endif
+  reset_stats();
+}
+
+void FlowCompensation::reset_stats() {
+  samples = 0;
+  err_sum = err_sq = err_max = 0;
+  factor_min = factor_max = 1.0f;
+}
+
+float FlowCompensation::fed_mm() {
+  #ifdef __AVR__
+    const bool was_enabled = stepper.suspend();
+  #endif
+  const int32_t s = fed_steps;
+  #ifdef __AVR__
+    if (was_enabled) stepper.wake_up();
+  #endif
+  return s * planner.mm_per_step[E_AXIS_N(FILAMENT_SENSOR_EXTRUDER_NUM)];
+}
+
+/**
+ * Called with each new width reading. The reading goes in the segment of
+ * filament now at the sensor, averaged with others in the same segment.
+ */
+void FlowCompensation::update() {
+  const float fed = fed_mm();
+
+  // With nothing queued the planner has fed what the steppers have
+  if (!planner.has_blocks_queued()) planned_mm = fed;
+
+  if (!filwidth.enabled) return;
+
+  const float err = filwidth.measured_mm - filwidth.nominal_mm;
+  if (ABS(err) <= FILWIDTH_ERROR_MARGIN) {
+    const int32_t seg = FLOOR(fed / (FLOWCOMP_SEGMENT_MM));
+    const uint16_t um = filwidth.measured_mm * 1000.0f;
+    width_t &w = widths[slot(seg)];
+    if (w.um && w.tag == uint16_t(seg))
+      w.um = (uint32_t(w.um) + um) >> 1;
+    else {
+      w.um = um;
+      w.tag = uint16_t(seg);
+    }
+
+    ++samples;
+    err_sum += err;
+    err_sq += sq(err);
+    NOLESS(err_max, ABS(err));
+  }
+
+  #if HAS_FLOWCOMP_ENCODER
+    /**
+     * Compare the filament fed over the window with the motion seen by the
+     * sensor. Filter the ratio slowly since each edge is a coarse step.
+     */
+    const float window = fed - window_mm;
+    if (window < 0) {
+      window_mm = fed;  // Retracted past the window start
+      edges = 0;
+    }
+    else if (window >= FLOWCOMP_ENCODER_WINDOW_MM) {
+      if (edges) {
+        slip += 0.1f * (window / (edges * (FLOWCOMP_ENCODER_MM)) - slip);
+        LIMIT(slip, 1.0f - (FLOWCOMP_MAX_CORRECTION) * 0.01f, 1.0f + (FLOWCOMP_MAX_CORRECTION) * 0.01f);
+      }
+      window_mm = fed;
+      edges = 0;
+    }
+  #endif
+}
+
+/**
+ * The filament melted by a block passed the sensor one measurement delay
+ * before it was fed. Take the reading for the middle of the block and scale
+ * the E by the ratio of the nominal to the measured area.
+ */
+float FlowCompensation::e_factor(const_float_t e_mm) {
+  if (!filwidth.enabled) return 1.0f;
+
+  const float at_sensor = planned_mm + e_mm * 0.5f - filwidth.meas_delay_cm * 10.0f;
+  const int32_t seg = FLOOR(at_sensor / (FLOWCOMP_SEGMENT_MM));
+  const width_t &w = widths[slot(seg)];
+  float f = (w.um && w.tag == uint16_t(seg)) ? sq(filwidth.nominal_mm * 1000.0f / w.um) : 1.0f;
+  TERN_(HAS_FLOWCOMP_ENCODER, f *= slip);
+
+  LIMIT(f, 1.0f - (FLOWCOMP_MAX_CORRECTION) * 0.01f, 1.0f + (FLOWCOMP_MAX_CORRECTION) * 0.01f);
+  NOMORE(factor_min, f);
+  NOLESS(factor_max, f);
+  return f;
+}
+
+void FlowCompensation::report() {
+  const float mean = samples ? err_sum / samples : 0,
+              sdev = samples ? SQRT(_MAX(err_sq / samples - sq(mean), 0.0f)) : 0;
+  SERIAL_ECHOLNPGM("Width error (mm) mean:", p_float_t(mean, 3), " std dev:", p_float_t(sdev, 3), " max:", p_float_t(err_max, 3), " samples:", samples);
+  SERIAL_ECHOPGM("Flow correction min:", p_float_t(100.0f * factor_min, 1), "% max:", p_float_t(100.0f * factor_max, 1), "%");
+  #if HAS_FLOWCOMP_ENCODER
+    SERIAL_ECHOPGM(" slip:", p_float_t(100.0f * slip, 1), "%");
+  #endif
+  SERIAL_EOL();
+}
+
+#endif // FILWIDTH_FLOW_COMPENSATION
@@ -0,0 +1,102 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * flowcomp.h - Per-block flow compensation from the filament width sensor
+ *
+ * Width readings are stored by the length of filament fed when they were
+ * taken, so each one can be found again when that filament reaches the
+ * nozzle. Each planned block has its E scaled for the width of the filament
+ * it melts. With a motion sensor the feed is also compared with the motion
+ * the sensor sees, to correct for the extruder slipping.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../module/planner.h"
+
+#ifdef FLOWCOMP_ENCODER_MM
+  #define HAS_FLOWCOMP_ENCODER 1
+#endif
+
+class FlowCompensation {
+public:
+  // Enough width readings to cover the longest measurement delay
+  static constexpr uint8_t SEGMENTS = ((MAX_MEASUREMENT_DELAY) * 10 + (FLOWCOMP_SEGMENT_MM) - 1) / (FLOWCOMP_SEGMENT_MM) + 2;
+
+  typedef struct {
+    uint16_t um;                      // (µm) Filament width. 0 for none.
+    uint16_t tag;                     // Segment number (low bits) of the reading
+  } width_t;
+
+  static width_t widths[SEGMENTS];    // Width readings ring, one per FLOWCOMP_SEGMENT_MM
+  static float planned_mm;            // (mm) Filament fed at the end of the last planned block
+  static volatile int32_t fed_steps;  // Filament fed by completed blocks
+
+  // Error statistics for M407
+  static uint32_t samples;            // Width readings taken
+  static float err_sum, err_sq,       // (mm) Sum and sum of squares of the width error
+               err_max,               // (mm) Largest width error
+               factor_min, factor_max; // Smallest and largest block corrections
+
+  #if HAS_FLOWCOMP_ENCODER
+    static float slip;                // Filament fed over motion seen by the sensor
+    static uint16_t edges;            // Motion sensor edges in this window
+    static float window_mm;           // (mm) Filament fed at the start of the window
+  #endif
+
+  static void reset();                // Forget the readings and start over
+  static void reset_stats();
+
+  // Filament fed by completed blocks
+  static float fed_mm();
+
+  // Store a new width reading for the filament now at the sensor
+  static void update();
+
+  // Correction for a block feeding e_mm after the last planned block
+  static float e_factor(const_float_t e_mm);
+
+  // A block was planned for the sensor extruder
+  static void advance_e(const_float_t e_mm) { planned_mm += e_mm; }
+
+  // Called by the Stepper ISR when a block is done
+  static void block_completed(const block_t * const b) {
+    if (b->extruder == FILAMENT_SENSOR_EXTRUDER_NUM && b->steps.e)
+      fed_steps += b->direction_bits.e ? int32_t(b->steps.e) : -int32_t(b->steps.e);
+  }
+
+  #if HAS_FLOWCOMP_ENCODER
+    // The motion sensor on the sensor extruder changed state
+    static void encoder_edge() { if (edges < UINT16_MAX) ++edges; }
+  #endif
+
+  static void report();
+
+private:
+  static uint8_t slot(const int32_t seg) {
+    const int32_t s = seg % SEGMENTS;
+    return s < 0 ? s + SEGMENTS : s;
+  }
+};
+
+extern FlowCompensation flowcomp;
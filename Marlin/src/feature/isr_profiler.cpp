@@ -0,0 +1,96 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_ISR_PROFILING)
+
+#include "isr_profiler.h"
+
+ISRProfiler isr_profiler;
+
+isr_phase_stats_t ISRProfiler::stats[ISR_PHASE_COUNT];
+uint32_t ISRProfiler::busy_ticks, ISRProfiler::period_ticks;
+
+void ISRProfiler::reset() {
+  for (uint8_t i = 0; i < ISR_PHASE_COUNT; ++i) {
+    hal.isr_off();
+    stats[i].reset();
+    hal.isr_on();
+  }
+  hal.isr_off();
+  busy_ticks = period_ticks = 0;
+  hal.isr_on();
+}
+
+static float ticks_to_us(const hal_timer_t ticks) { return float(ticks) / float(STEPPER_TIMER_TICKS_PER_US); }
+
+void ISRProfiler::report() {
+  static PGMSTR(str_isr, "ISR");
+  static PGMSTR(str_pulse, "Pulse");
+  static PGMSTR(str_block, "Block");
+  static PGMSTR(str_advance, "Advance");
+  static PGMSTR(str_shaping, "Shaping");
+  static PGMSTR(str_babystep, "Babystep");
+  static PGM_P const phase_name[ISR_PHASE_COUNT] PROGMEM = {
+    str_isr, str_pulse, str_block, str_advance, str_shaping, str_babystep
+  };
+
+  hal.isr_off();
+  const uint32_t busy = busy_ticks, period = period_ticks;
+  hal.isr_on();
+
+  SERIAL_ECHOPGM("Stepper ISR load: ");
+  if (period)
+    SERIAL_ECHOLN(p_float_t(100.0f * busy / period, 2), C('%'));
+  else
+    SERIAL_ECHOLNPGM("-");
+
+  SERIAL_ECHOLNPGM("Histogram bucket n counts times under 2^n ticks of ", p_float_t(1000.0f / (STEPPER_TIMER_TICKS_PER_US), 1), "ns");
+
+  for (uint8_t i = 0; i < ISR_PHASE_COUNT; ++i) {
+    // Copy the stats so they're consistent for the whole report
+    hal.isr_off();
+    const isr_phase_stats_t s = stats[i];
+    hal.isr_on();
+
+    if (!s.samples) continue;
+
+    SERIAL_ECHOPGM_P((PGM_P)pgm_read_ptr(&phase_name[i]));
+    SERIAL_ECHOLNPGM(
+      " calls:", s.samples,
+      " min:", p_float_t(ticks_to_us(s.min), 2),
+      " avg:", p_float_t(ticks_to_us(s.avg()), 2),
+      " max:", p_float_t(ticks_to_us(s.max), 2), "us"
+    );
+
+    // Print the histogram, omitting the empty buckets at either end
+    int8_t lo = 0, hi = ISR_PROFILE_BUCKETS - 1;
+    while (!s.hist[lo]) lo++;
+    while (!s.hist[hi]) hi--;
+    SERIAL_ECHOPGM(" ");
+    for (int8_t b = lo; b <= hi; ++b) SERIAL_ECHO(C(' '), b, C(':'), s.hist[b]);
+    SERIAL_EOL();
+  }
+}
+
+#endif // STEPPER_ISR_PROFILING
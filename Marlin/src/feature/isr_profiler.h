@@ -0,0 +1,98 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * isr_profiler.h - Stepper ISR load profiler
+ *
+ * Times each phase of the Stepper ISR with the Stepper timer and keeps
+ * min / avg / max and a log2 histogram of the durations, plus the share
+ * of time spent in the ISR overall. Reported and reset with M101.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define ISR_PROFILE_BUCKETS 16  // Bucket n counts durations of 2^(n-1) to 2^n-1 ticks. The last bucket counts the rest.
+
+enum ISRPhase : uint8_t {
+  ISR_PHASE_ALL,        // The whole Stepper ISR
+  ISR_PHASE_PULSE,      // pulse_phase_isr
+  ISR_PHASE_BLOCK,      // block_phase_isr
+  ISR_PHASE_ADVANCE,    // advance_isr
+  ISR_PHASE_SHAPING,    // shaping_isr
+  ISR_PHASE_BABYSTEP,   // babystepping_isr
+  ISR_PHASE_COUNT
+};
+
+typedef struct {
+  hal_timer_t min, max;                     // Shortest and longest durations, in ticks
+  uint32_t samples;                         // Number of calls (saturating)
+  uint32_t total, total_samples;            // Sum of durations for the average. Both are halved to prevent overflow.
+  uint32_t hist[ISR_PROFILE_BUCKETS];       // log2 histogram of durations
+
+  void reset() { min = max = 0; samples = total = total_samples = 0; ZERO(hist); }
+
+  void sample(const hal_timer_t ticks) {
+    if (!samples || ticks < min) min = ticks;
+    NOLESS(max, ticks);
+    if (samples < UINT32_MAX) samples++;
+    if (total & 0x80000000UL) { total >>= 1; total_samples >>= 1; }
+    total += ticks;
+    total_samples++;
+    uint8_t b = 0;
+    for (hal_timer_t t = ticks; t && b < ISR_PROFILE_BUCKETS - 1; t >>= 1) b++;
+    hist[b]++;
+  }
+
+  hal_timer_t avg() const { return total_samples ? total / total_samples : 0; }
+
+} isr_phase_stats_t;
+
+class ISRProfiler {
+public:
+  static isr_phase_stats_t stats[ISR_PHASE_COUNT];
+  static uint32_t busy_ticks, period_ticks;   // Time in the ISR and total time, for the load. Both are halved to prevent overflow.
+
+  static void reset();
+  static void report();
+
+  // Called at the end of the Stepper ISR with the ticks spent in the ISR and until the next ISR
+  static void sample_isr(const hal_timer_t busy, const hal_timer_t period) {
+    stats[ISR_PHASE_ALL].sample(busy);
+    if (period_ticks & 0x80000000UL) { busy_ticks >>= 1; period_ticks >>= 1; }
+    busy_ticks += busy;
+    period_ticks += period;
+  }
+
+  // Time the rest of the enclosing scope as one phase
+  class Scope {
+    const ISRPhase phase;
+    const hal_timer_t start;
+  public:
+    Scope(const ISRPhase p) : phase(p), start(HAL_timer_get_count(MF_TIMER_STEP)) {}
+    ~Scope() { stats[phase].sample(HAL_timer_get_count(MF_TIMER_STEP) - start); }
+  };
+};
+
+extern ISRProfiler isr_profiler;
+
+#define PROFILE_ISR_PHASE(P) const ISRProfiler::Scope _isr_phase_scope(ISR_PHASE_##P)
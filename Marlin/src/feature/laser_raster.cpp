@@ -0,0 +1,68 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(LASER_RASTER)
+
+#include "laser_raster.h"
+#include "../MarlinCore.h" // for idle()
+
+LaserRaster laser_raster;
+
+uint8_t LaserRaster::data[LASER_RASTER_LINES][LASER_RASTER_PIXELS];
+uint16_t LaserRaster::length[LASER_RASTER_LINES];
+uint8_t LaserRaster::head;
+volatile uint8_t LaserRaster::tail;
+
+static uint8_t base64_value(const char c) {
+  if (WITHIN(c, 'A', 'Z')) return c - 'A';
+  if (WITHIN(c, 'a', 'z')) return c - 'a' + 26;
+  if (WITHIN(c, '0', '9')) return c - '0' + 52;
+  if (c == '+') return 62;
+  if (c == '/') return 63;
+  return 0xFF;
+}
+
+bool LaserRaster::append_base64(const char *str) {
+  // Before starting a new line, wait until attaching it will leave a free line to upload
+  if (!length[head]) while (next(head) == tail) idle();
+
+  uint8_t * const line = data[head];
+  uint16_t &len = length[head];
+  uint16_t bits = 0;
+  uint8_t nbits = 0;
+  for (; *str; ++str) {
+    const uint8_t v = base64_value(*str);
+    if (v > 63) continue; // Skip padding and spaces
+    bits = (bits << 6) | v;
+    nbits += 6;
+    if (nbits >= 8) {
+      nbits -= 8;
+      if (len >= LASER_RASTER_PIXELS) return false;
+      line[len++] = uint8_t(bits >> nbits);
+    }
+  }
+  return true;
+}
+
+#endif // LASER_RASTER
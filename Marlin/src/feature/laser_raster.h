@@ -0,0 +1,79 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/laser_raster.h
+ * Raster lines of laser power, each carried by a single planner block
+ *
+ * M650 uploads a line of pixels. The next powered G1 takes the line and
+ * the Stepper ISR sets the power for each pixel as the move goes along,
+ * so a whole scanline is one block instead of one G1 per pixel.
+ *
+ * Lines are used in order, so they're kept in a ring. The Stepper ISR
+ * frees each line when its block is done.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class LaserRaster {
+public:
+  // Append base64-encoded pixels to the line being uploaded. False if it's too long.
+  static bool append_base64(const char *str);
+
+  // Forget the line being uploaded
+  static void discard() { length[head] = 0; }
+
+  // Pixels in the line being uploaded
+  static uint16_t uploaded() { return length[head]; }
+
+  /**
+   * Give the uploaded line to a new block. Called by the planner.
+   * Return the line number + 1, or 0 for no line.
+   */
+  static uint8_t attach() {
+    if (!length[head]) return 0;
+    const uint8_t line = head;
+    head = next(head);            // Always free. See append_base64.
+    length[head] = 0;
+    return line + 1;
+  }
+
+  // The Stepper ISR is done with a line
+  static void release(const uint8_t line) { if (line == tail) tail = next(tail); }
+
+  // Drop all lines. For quick_stop.
+  static void clear() { tail = head; length[head] = 0; }
+
+  static const uint8_t* pixels(const uint8_t line) { return data[line]; }
+  static uint16_t pixel_count(const uint8_t line) { return length[line]; }
+
+private:
+  static uint8_t data[LASER_RASTER_LINES][LASER_RASTER_PIXELS];
+  static uint16_t length[LASER_RASTER_LINES];
+  static uint8_t head;            // The line being uploaded
+  static volatile uint8_t tail;   // The oldest line in use by a block
+
+  static uint8_t next(const uint8_t line) { return line + 1 < LASER_RASTER_LINES ? line + 1 : 0; }
+};
+
+extern LaserRaster laser_raster;
@@ -162,25 +162,27 @@ void Mixer::refresh_collector(const float proportion/*=1.0*/, const uint8_t t/*=
     0, 1,                       // start_vtool, end_vtool
     {0}, {0}                    // start_mix[], end_mix[]
     OPTARG(GRADIENT_VTOOL, -1)  // vtool_index
+    , 0, -1                     // step_scale, step
   };
 
-  float Mixer::prev_z; // = 0
-
+  /**
+   * Most blocks stay on the same gradient step, so this is just a compare.
+   * A new step gets its mix and color with integer math.
+   */
   void Mixer::update_gradient_for_z(const_float_t z) {
-    if (z == prev_z) return;
-    prev_z = z;
-
-    const float slice = gradient.end_z - gradient.start_z;
-
-    float pct = (z - gradient.start_z) / slice;
-    NOLESS(pct, 0.0f); NOMORE(pct, 1.0f);
+    const int8_t step = gradient_step(z);
+    if (step == gradient.step) return;
+    gradient.step = step;
 
+    mixer_perc_t mmax = 0;
     MIXER_STEPPER_LOOP(i) {
-      const mixer_perc_t sm = gradient.start_mix[i];
-      mix[i] = sm + (gradient.end_mix[i] - sm) * pct;
+      const int16_t sm = gradient.start_mix[i];
+      mix[i] = (sm * 100 + (gradient.end_mix[i] - sm) * step) / 100;
+      NOLESS(mmax, mix[i]);
     }
 
-    copy_mix_to_color(gradient.color);
+    // Scale so the largest component is COLOR_A_MASK
+    if (mmax) MIXER_STEPPER_LOOP(i) gradient.color[i] = uint32_t(mix[i]) * (COLOR_A_MASK) / mmax;
   }
 
   void Mixer::update_gradient_for_planner_z() {
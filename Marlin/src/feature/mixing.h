@@ -71,6 +71,8 @@ static_assert(NR_MIXING_VIRTUAL_TOOLS <= MAX_VTOOLS, "MIXING_VIRTUAL_TOOLS must
     #if ENABLED(GRADIENT_VTOOL)
       int8_t vtool_index;                 // Use this virtual tool number as index
     #endif
+    float step_scale;                     // Gradient steps per mm of Z
+    int8_t step;                          // Gradient step (0-100) of the current color
   } gradient_t;
 
 #endif
@@ -171,17 +173,22 @@ class Mixer {
   #if ENABLED(GRADIENT_MIX)
 
     static gradient_t gradient;
-    static float prev_z;
+
+    // The gradient mix changes in 1% steps. Get the step for a given Z.
+    static int8_t gradient_step(const_float_t z) {
+      const float s = (z - gradient.start_z) * gradient.step_scale;
+      return s <= 0 ? 0 : s >= 100 ? 100 : int8_t(s);
+    }
 
     // Update the current mix from the gradient for a given Z
     static void update_gradient_for_z(const_float_t z);
     static void update_gradient_for_planner_z();
     static void gradient_control(const_float_t z) {
       if (gradient.enabled) {
-        if (z >= gradient.end_z)
-          T(gradient.end_vtool);
-        else
+        if (z < gradient.end_z)
           update_gradient_for_z(z);
+        else if (selected_vtool != uint8_t(gradient.end_vtool))
+          T(gradient.end_vtool);
       }
     }
 
@@ -213,9 +220,10 @@ class Mixer {
         COPY(gradient.start_mix, mix);
         update_mix_from_vtool(gradient.end_vtool);
         COPY(gradient.end_mix, mix);
+        gradient.step_scale = 100.0f / (gradient.end_z - gradient.start_z);
+        gradient.step = -1;
         update_gradient_for_planner_z();
         COPY(mix, mix_bak);
-        prev_z = -1;
       }
     }
 
@@ -26,7 +26,7 @@
 
 #include "../../inc/MarlinConfigPre.h"
 
-#if HAS_PRUSA_MMU3
+#if HAS_PRUSA_MMU3 || ENABLED(UNIT_TEST) // The framing is unit tested without an MMU
 
 #include "mmu3_crc.h"
 
@@ -38,6 +38,10 @@ namespace modules {
 
 namespace crc {
 
+#ifndef __AVR__
+  constexpr uint8_t CRC8::table[256];
+#endif
+
 uint8_t CRC8::CCITT_update(uint8_t crc, uint8_t b) {
   #ifdef __AVR__
     return _crc8_ccitt_update(crc, b);
@@ -50,4 +54,4 @@ uint8_t CRC8::CCITT_update(uint8_t crc, uint8_t b) {
 
 } // namespace modules
 
-#endif // HAS_PRUSA_MMU3
+#endif // HAS_PRUSA_MMU3 || UNIT_TEST
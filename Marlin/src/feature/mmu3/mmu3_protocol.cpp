@@ -26,7 +26,7 @@
 
 #include "../../inc/MarlinConfigPre.h"
 
-#if HAS_PRUSA_MMU3
+#if HAS_PRUSA_MMU3 || ENABLED(UNIT_TEST) // The framing is unit tested without an MMU
 
 #include "mmu3_protocol.h"
 
@@ -415,4 +415,4 @@ namespace protocol {
 } // namespace protocol
 } // namespace modules
 
-#endif // HAS_PRUSA_MMU3
+#endif // HAS_PRUSA_MMU3 || UNIT_TEST
@@ -381,7 +381,7 @@ namespace MMU3 {
   }
 
   StepStatus ProtocolLogic::CommandWait() {
-    if (Elapsed(heartBeatPeriod))
+    if (Elapsed(commandQueryPeriod))
       SendQuery();
     else
       // even when waiting for a query period, we need to report a change in filament sensor's state
@@ -438,6 +438,7 @@ namespace MMU3 {
             progressCode = ProgressCode::OK;
             errorCode = ErrorCode::RUNNING;
             scopeState = ScopeState::Wait;
+            TERN_(MMU3_PIPELINED_QUERIES, SendQuery()); // ask for progress right away
             break;
           case ResponseMsgParamCodes::Rejected:
             // rejected - should normally not happen, but report the error up
@@ -94,6 +94,13 @@ namespace MMU3 {
 
   static_assert(heartBeatPeriod < linkLayerTimeout && linkLayerTimeout < dataLayerTimeout, "Incorrect ordering of timeouts");
 
+  #if ENABLED(MMU3_PIPELINED_QUERIES)
+    /*inline*/ constexpr uint32_t commandQueryPeriod = MMU3_QUERY_PERIOD;  //!< Period of Q0 while a command is running
+    static_assert(commandQueryPeriod > 0 && commandQueryPeriod < heartBeatPeriod, "MMU3_QUERY_PERIOD must be between 1 and 999.");
+  #else
+    /*inline*/ constexpr uint32_t commandQueryPeriod = heartBeatPeriod;
+  #endif
+
   //!< Filter of short consecutive drop outs which are recovered instantly
   class DropOutFilter {
     public:
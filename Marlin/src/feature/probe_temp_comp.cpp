@@ -30,6 +30,10 @@
 #include <math.h>
 #include "../module/temperature.h"
 
+#if ENABLED(PTC_ONLINE_FIT)
+  #include "../module/probe.h"
+#endif
+
 ProbeTempComp ptc;
 
 #if ENABLED(PTC_PROBE)
@@ -65,10 +69,31 @@ uint8_t ProbeTempComp::calib_idx; // = 0
 float ProbeTempComp::init_measurement; // = 0.0
 bool ProbeTempComp::enabled = true;
 
+#if ENABLED(PTC_ONLINE_FIT)
+  ptc_model_t ProbeTempComp::model;
+  ProbeTempComp::fit_point_t ProbeTempComp::fit_points[PTC_FIT_POINTS];
+  uint8_t ProbeTempComp::fit_count, ProbeTempComp::fit_next; // = 0
+  float ProbeTempComp::fit_p[TSI_COUNT][TSI_COUNT];
+
+  // Without probe Z homing the offsets are zero at the start temperatures, as with the tables
+  float ProbeTempComp::ref_temp[TSI_COUNT] = {
+    #if ENABLED(PTC_PROBE)
+      PTC_PROBE_START,
+    #endif
+    #if ENABLED(PTC_BED)
+      PTC_BED_START,
+    #endif
+    #if ENABLED(PTC_HOTEND)
+      PTC_HOTEND_START,
+    #endif
+  };
+#endif
+
 void ProbeTempComp::reset() {
   TERN_(PTC_PROBE, for (uint8_t i = 0; i < PTC_PROBE_COUNT; ++i) z_offsets_probe[i] = z_offsets_probe_default[i]);
   TERN_(PTC_BED, for (uint8_t i = 0; i < PTC_BED_COUNT; ++i) z_offsets_bed[i] = z_offsets_bed_default[i]);
   TERN_(PTC_HOTEND, for (uint8_t i = 0; i < PTC_HOTEND_COUNT; ++i) z_offsets_hotend[i] = z_offsets_hotend_default[i]);
+  TERN_(PTC_ONLINE_FIT, reset_model());
 }
 
 void ProbeTempComp::clear_offsets(const TempSensorID tsi) {
@@ -94,6 +119,12 @@ void ProbeTempComp::print_offsets() {
       temp += cali_info[s].temp_resolution;
     }
   }
+  #if ENABLED(PTC_ONLINE_FIT)
+    SERIAL_ECHOPGM("Drift model (um/C)");
+    for (uint8_t s = 0; s < TSI_COUNT; ++s)
+      SERIAL_ECHO(TERN_(PTC_BED, s == TSI_BED ? F(" Bed:") :) TERN_(PTC_HOTEND, s == TSI_EXT ? F(" Extruder:") :) F(" Probe:"), p_float_t(model.k[s], 2));
+    SERIAL_ECHOLNPGM(" Samples:", model.samples);
+  #endif
   #if ENABLED(DEBUG_PTC)
     float meas[4] = { 0, 0, 0, 0 };
     compensate_measurement(TSI_PROBE, 27.5, meas[0]);
@@ -163,16 +194,119 @@ bool ProbeTempComp::finish_calibration(const TempSensorID tsi) {
     }
   }
 
+  // The model was fitted to what the old table left over
+  TERN_(PTC_ONLINE_FIT, reset_model());
+
   return true;
 }
 
-void ProbeTempComp::apply_compensation(float &meas_z) {
+void ProbeTempComp::apply_compensation(float &meas_z OPTARG(PTC_ONLINE_FIT, const xy_pos_t &pos)) {
   if (!enabled) return;
   TERN_(PTC_BED,    compensate_measurement(TSI_BED,   thermalManager.degBed(),     meas_z));
   TERN_(PTC_PROBE,  compensate_measurement(TSI_PROBE, thermalManager.degProbe(),   meas_z));
   TERN_(PTC_HOTEND, compensate_measurement(TSI_EXT,   thermalManager.degHotend(0), meas_z));
+
+  #if ENABLED(PTC_ONLINE_FIT)
+    // Learn the drift left over by the tables, then take it out
+    float u[TSI_COUNT];
+    get_temps(u);
+    fit_observe(pos, meas_z - probe.offset.z, u);
+    meas_z -= model_offset(u) / 1000.0f;
+  #endif
 }
 
+#if ENABLED(PTC_ONLINE_FIT)
+
+  // Prior variance of each drift coefficient, in (µm/°C)² over the measurement noise
+  constexpr float fit_p0 = 1.0f;
+
+  void ProbeTempComp::reset_model() {
+    for (uint8_t s = 0; s < TSI_COUNT; ++s) model.k[s] = 0;
+    model.samples = 0;
+    init_fit();
+  }
+
+  /**
+   * Only the model is saved, so take the confidence
+   * in it from the number of observations.
+   */
+  void ProbeTempComp::init_fit() {
+    for (uint8_t i = 0; i < TSI_COUNT; ++i)
+      for (uint8_t j = 0; j < TSI_COUNT; ++j)
+        fit_p[i][j] = i == j ? fit_p0 / (1 + model.samples) : 0;
+    fit_count = fit_next = 0;
+  }
+
+  static void read_temps(float (&t)[TSI_COUNT]) {
+    TERN_(PTC_PROBE,  t[TSI_PROBE] = thermalManager.degProbe());
+    TERN_(PTC_BED,    t[TSI_BED]   = thermalManager.degBed());
+    TERN_(PTC_HOTEND, t[TSI_EXT]   = thermalManager.degHotend(0));
+  }
+
+  // The drift at the homing temperatures is part of the new Z reference
+  void ProbeTempComp::z_homed() { read_temps(ref_temp); }
+
+  void ProbeTempComp::get_temps(float (&u)[TSI_COUNT]) {
+    read_temps(u);
+    for (uint8_t s = 0; s < TSI_COUNT; ++s) u[s] -= ref_temp[s];
+  }
+
+  /**
+   * A point probed before at other temperatures gives the change in Z for
+   * the change in temperatures. The bed shape is the same at both, so the
+   * change is all drift. Fit the drift per degree of each sensor to all the
+   * changes seen by recursive least squares.
+   */
+  void ProbeTempComp::fit_observe(const xy_pos_t &pos, const_float_t z, const float (&u)[TSI_COUNT]) {
+    const int16_t x = LROUND(pos.x * 10), y = LROUND(pos.y * 10),
+                  z_um = LROUND(constrain(z, -30.0f, 30.0f) * 1000);
+
+    uint8_t i = 0;
+    for (; i < fit_count; ++i) if (ABS(fit_points[i].x - x) <= 5 && ABS(fit_points[i].y - y) <= 5) break;
+
+    if (i < fit_count) {
+      fit_point_t &fp = fit_points[i];
+      float du[TSI_COUNT], du_max = 0;
+      for (uint8_t s = 0; s < TSI_COUNT; ++s) {
+        du[s] = u[s] - fp.u[s] * 0.1f;
+        NOLESS(du_max, ABS(du[s]));
+      }
+
+      // Keep the earlier reading until the temperatures have moved enough
+      if (du_max < PTC_FIT_MIN_DELTA) return;
+
+      // Error of the model for this change. Much more than drift means the bed or probe changed.
+      float err = z_um - fp.z;
+      for (uint8_t s = 0; s < TSI_COUNT; ++s) err -= model.k[s] * du[s];
+      if (ABS(err) < 500) {
+        float pu[TSI_COUNT], den = 1.0f;
+        for (uint8_t s = 0; s < TSI_COUNT; ++s) {
+          pu[s] = 0;
+          for (uint8_t t = 0; t < TSI_COUNT; ++t) pu[s] += fit_p[s][t] * du[t];
+          den += du[s] * pu[s];
+        }
+        for (uint8_t s = 0; s < TSI_COUNT; ++s) {
+          const float gain = pu[s] / den;
+          model.k[s] += gain * err;
+          for (uint8_t t = 0; t < TSI_COUNT; ++t) fit_p[s][t] -= gain * pu[t];
+        }
+        if (model.samples < UINT16_MAX) ++model.samples;
+      }
+    }
+    else {
+      // A new point replaces the oldest
+      i = fit_next;
+      fit_next = (fit_next + 1) % (PTC_FIT_POINTS);
+      if (fit_count < PTC_FIT_POINTS) ++fit_count;
+    }
+
+    fit_point_t &fp = fit_points[i];
+    fp.x = x; fp.y = y; fp.z = z_um;
+    for (uint8_t s = 0; s < TSI_COUNT; ++s) fp.u[s] = LROUND(u[s] * 10);
+  }
+
+#endif // PTC_ONLINE_FIT
+
 void ProbeTempComp::compensate_measurement(const TempSensorID tsi, const celsius_t temp, float &meas_z) {
   const uint8_t measurements = cali_info[tsi].measurements;
   const celsius_t start_temp = cali_info[tsi].start_temp,
@@ -42,6 +42,13 @@ typedef struct {
             start_temp;       // Base measurement; z-offset == 0
 } temp_calib_t;
 
+#if ENABLED(PTC_ONLINE_FIT)
+  typedef struct {
+    float k[TSI_COUNT];         // (µm/°C) Z drift per degree of each sensor
+    uint16_t samples;           // Number of observations fitted
+  } ptc_model_t;
+#endif
+
 /**
  * Probe temperature compensation implementation.
  * Z-probes like the P.I.N.D.A V2 allow for compensation of
@@ -90,12 +97,45 @@ class ProbeTempComp {
     static void set_enabled(const bool ena) { enabled = ena; }
 
     // Apply all temperature compensation adjustments
-    static void apply_compensation(float &meas_z);
+    static void apply_compensation(float &meas_z OPTARG(PTC_ONLINE_FIT, const xy_pos_t &pos));
+
+    #if ENABLED(PTC_ONLINE_FIT)
+      static ptc_model_t model;
+      static void reset_model();
+      static void init_fit();                     // Start fitting from the stored model
+      static void z_homed();                      // Z was homed with the probe at the current temperatures
+
+      // Sensor temperatures relative to those at the Z reference
+      static void get_temps(float (&u)[TSI_COUNT]);
+
+      // Learn from a probe at pos (Z in mm) with sensor temperatures u
+      static void fit_observe(const xy_pos_t &pos, const_float_t z, const float (&u)[TSI_COUNT]);
+
+      // The modeled drift in µm for sensor temperatures u
+      static float model_offset(const float (&u)[TSI_COUNT]) {
+        float offset = 0;
+        for (uint8_t s = 0; s < TSI_COUNT; ++s) offset += model.k[s] * u[s];
+        return offset;
+      }
+    #endif
 
   private:
     static uint8_t calib_idx;
     static bool enabled;
 
+    #if ENABLED(PTC_ONLINE_FIT)
+      typedef struct {
+        int16_t x, y;                 // (0.1mm) Nozzle position
+        int16_t z;                    // (µm) Measured Z
+        int16_t u[TSI_COUNT];         // (0.1°C) Sensor temperatures relative to the Z reference
+      } fit_point_t;
+
+      static fit_point_t fit_points[PTC_FIT_POINTS];  // The last probe at each point
+      static uint8_t fit_count, fit_next;
+      static float fit_p[TSI_COUNT][TSI_COUNT];       // Covariance of the model, scaled by the noise
+      static float ref_temp[TSI_COUNT];               // (°C) Sensor temperatures at the Z reference
+    #endif
+
     static void clear_offsets(const TempSensorID tsi);
 
     /**
@@ -39,6 +39,10 @@
   #include "../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(FILWIDTH_FLOW_COMPENSATION)
+  #include "flowcomp.h"
+#endif
+
 //#define FILAMENT_RUNOUT_SENSOR_DEBUG
 #ifndef FILAMENT_RUNOUT_THRESHOLD
   #define FILAMENT_RUNOUT_THRESHOLD 5
@@ -264,6 +268,10 @@ class FilamentSensorBase {
         #endif
 
         motion_detected |= change;
+
+        #if HAS_FLOWCOMP_ENCODER
+          if (TEST(change, FILAMENT_SENSOR_EXTRUDER_NUM)) flowcomp.encoder_edge();
+        #endif
       }
 
     public:
@@ -0,0 +1,99 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if HAS_HEATSHRINK_STREAM
+
+#include "stream_decode.h"
+
+/**
+ * Fill the output buffer from the input block. Stop when the output is full
+ * or the input is used up. Decoded data always goes out before any input
+ * that follows its frame.
+ */
+void StreamDecoder::process() {
+  if (out_pos == out_len) out_pos = out_len = 0;
+
+  while (out_len < sizeof(out)) {
+
+    // Decompression stage
+    if (state == DATA || state == DRAIN) {
+      out_len += unpacker.poll(&out[out_len], sizeof(out) - out_len);
+      if (out_len == sizeof(out)) return;     // Output full, maybe more to come
+      if (state == DRAIN) { state = PLAIN; continue; }
+    }
+
+    if (in_pos == in_len) return;             // Need more input
+
+    if (state == DATA) {
+      const uint8_t len = _MIN(uint16_t(in_len - in_pos), frame_left);
+      const uint8_t count = unpacker.sink(&in[in_pos], len);
+      in_pos += count;
+      frame_left -= count;
+      if (!frame_left) { unpacker.finish(); state = DRAIN; }
+      continue;
+    }
+
+    // Framing stage
+    const uint8_t c = in[in_pos++];
+    switch (state) {
+      case PLAIN:
+        if (c == kFrameMark) state = MARK; else out[out_len++] = c;
+        break;
+      case MARK:
+        state = PLAIN;
+        if (c == kFrameMark)
+          state = SIZE;
+        else {
+          out[out_len++] = kFrameMark;        // A lone mark is data. Look at c again.
+          in_pos--;
+        }
+        break;
+      case SIZE:
+        frame_left = c;
+        state = SIZE2;
+        break;
+      case SIZE2:
+        frame_left |= uint16_t(c) << 8;
+        state = CHECK;
+        break;
+      case CHECK:
+        if (frame_left > kFrameMax || c != uint8_t(frame_left ^ (frame_left >> 8) ^ 0xFF)) {
+          frame_left = kFrameMax;                 // A bad header. Skip to the next frame.
+          state = SKIP;
+        }
+        else if (frame_left) { unpacker.reset(); state = DATA; }
+        else state = PLAIN;
+        break;
+      case SKIP:
+      case SKIP_MARK:
+        if (state == SKIP_MARK && c == kFrameMark) { state = SIZE; break; }
+        state = c == kFrameMark ? SKIP_MARK : SKIP;
+        if (!--frame_left) state = state == SKIP_MARK ? MARK : PLAIN; // Past the largest frame
+        break;
+      default: break;
+    }
+  }
+}
+
+#endif // HAS_HEATSHRINK_STREAM
@@ -0,0 +1,122 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Compressed G-code streaming
+ *
+ * Serial input is decoded in layers, a buffer at a time:
+ *
+ *   framing -> decompression -> (MeatPack) -> line assembly (GCodeQueue)
+ *
+ * Plain G-code passes through unchanged. A host may also send blocks of
+ * G-code compressed with heatshrink (window 8, lookahead 4) as frames:
+ *
+ *   0xFE 0xFE <size LSB> <size MSB> <check> <compressed data>
+ *
+ * Each frame is a complete heatshrink stream of up to 1024 bytes, and
+ * <check> is (size LSB ^ size MSB ^ 0xFF). 0xFE 0xFE never occurs in
+ * G-code or MeatPack data.
+ *
+ * A frame with a bad size or check byte is dropped, along with the input
+ * after it up to the next frame mark or for up to 1024 bytes. The lines
+ * that were lost put the next line number out of sequence, so the host is
+ * asked to resend them. Damaged data in a good frame decodes to lines that
+ * fail their checksums, and these are sent again like any bad line.
+ */
+
+#include "../core/serial_hook.h"
+#include "../libs/heatshrink/heatshrink_stream.h"
+
+class StreamDecoder {
+  static constexpr uint8_t kFrameMark = 0xFE;
+  static constexpr uint16_t kFrameMax = 1024;
+
+  enum FrameState : uint8_t { PLAIN, MARK, SIZE, SIZE2, CHECK, DATA, DRAIN, SKIP, SKIP_MARK };
+
+  FrameState state;
+  uint16_t frame_left;          // Compressed bytes still to come, or bytes to skip
+  HeatshrinkStream unpacker;
+
+  uint8_t in[32], in_pos, in_len;
+  uint8_t out[64], out_pos, out_len;
+
+public:
+  StreamDecoder() : state(PLAIN), in_pos(0), in_len(0), out_pos(0), out_len(0) {}
+
+  // Take raw input only when the last block is used up
+  bool wants_input() const { return in_pos == in_len; }
+  void put(const uint8_t c) {
+    if (wants_input()) in_pos = in_len = 0;
+    if (in_len < sizeof(in)) in[in_len++] = c;
+  }
+  bool input_full() const { return !wants_input() && in_len == sizeof(in); }
+
+  // Run the input through the layers to fill the output buffer
+  void process();
+
+  uint8_t available() const { return out_len - out_pos; }
+  uint8_t read() { return out[out_pos++]; }
+};
+
+// The decode layer as a serial port, so it's transparent to the rest of the code
+template <typename SerialT>
+struct StreamDecodeSerial : public SerialBase <StreamDecodeSerial < SerialT >> {
+  typedef SerialBase< StreamDecodeSerial<SerialT> > BaseClassT;
+
+  SerialT & out;
+  StreamDecoder decoder;
+
+  NO_INLINE void write(uint8_t c)     { out.write(c); }
+  void flush()                        { out.flush();  }
+  void begin(long br)                 { out.begin(br); }
+  void end()                          { out.end(); }
+
+  void msgDone()                      { out.msgDone(); }
+  bool connected()                    { return Private::HasMember_connected<SerialT>::value ? CALL_IF_EXISTS(bool, &out, connected) : (bool)out; }
+  void flushTX()                      { CALL_IF_EXISTS(void, &out, flushTX); }
+  SerialFeature features(serial_index_t index) const  { return SerialFeature::Compression | CALL_IF_EXISTS(SerialFeature, &out, features, index);  }
+
+  int available(serial_index_t index) {
+    if (!decoder.available()) {
+      // Read a block of raw input, then decode as much as the output buffer will hold
+      if (decoder.wants_input())
+        while (!decoder.input_full() && out.available(index) > 0) {
+          const int r = out.read(index);
+          if (r < 0) break;
+          decoder.put(r);
+        }
+      decoder.process();
+    }
+    return decoder.available();
+  }
+
+  int read(serial_index_t index) {
+    if (!available(index)) return -1;
+    return decoder.read();
+  }
+
+  int available()                 { return available(0); }
+  int read()                      { return read(0); }
+
+  StreamDecodeSerial(const bool e, SerialT & out) : BaseClassT(e), out(out) {}
+};
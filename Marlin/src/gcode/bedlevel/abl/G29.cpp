@@ -792,6 +792,7 @@ G29_TYPE GcodeSuite::G29() {
 
             const float z = abl.measured_z + abl.Z_offset;
             abl.z_values[abl.meshCount.x][abl.meshCount.y] = z;
+            TERN_(ADAPTIVE_PROBING, bedlevel.z_spread[abl.meshCount.x][abl.meshCount.y] = faux ? 0 : probe.sample_spread);
             TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(abl.meshCount, z));
 
             #if ENABLED(SOVOL_SV06_RTS)
@@ -39,6 +39,10 @@
   #include "../../feature/bedlevel/bedlevel.h"
 #endif
 
+#if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+  #include "../../module/delta_calibration.h"
+#endif
+
 constexpr uint8_t _7P_STEP = 1,              // 7-point step - to change number of calibration points
                   _4P_STEP = _7P_STEP * 2,   // 4-point step
                   NPP      = _7P_STEP * 6;   // number of calibration points on the radius
@@ -312,6 +316,61 @@ static void calc_kinematics_diff_probe_points(float z_pt[NPP + 1], const float d
   recalc_delta_settings();
 }
 
+#if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+
+  /**
+   * - Probe rings of points in one pass and fit all the delta settings to them
+   */
+  static bool least_squares_calibration(const float dcr, const uint8_t rings, const bool towers_set, const int8_t verbose_level, const bool stow_after_each, const bool probe_at_offset) {
+    DeltaCalibration cal;
+    const uint8_t count = DeltaCalibration::point_count(rings);
+    for (uint8_t i = 0; i < count; ++i) {
+      xy_pos_t xy = DeltaCalibration::point(i, rings, dcr);
+      const float z = calibration_probe(xy, stow_after_each, probe_at_offset);
+      if (isnan(z)) return false;
+      #if HAS_PROBE_XY_OFFSET
+        if (probe_at_offset) xy -= probe.offset_xy; // The kinematics are for the nozzle
+      #endif
+      cal.add_point(xy, z);
+    }
+    do_blocking_move_to_xy(0.0f, 0.0f);
+
+    const float rms_before = cal.rms();
+    SERIAL_ECHO(cal.points(), F(" points"));
+    SERIAL_ECHO_SP(32);
+    SERIAL_ECHOLNPGM("std dev:", p_float_t(rms_before, 3));
+    if (verbose_level == 0) return true;                       // dry run
+
+    const uint8_t iterations = cal.fit(towers_set);
+    const float rms_after = cal.rms();
+
+    if (verbose_level == 3) {
+      for (uint8_t i = 0; i < count; ++i) {
+        const xy_pos_t xy = DeltaCalibration::point(i, rings, dcr);
+        SERIAL_ECHOPGM(".  X", p_float_t(xy.x, 1), " Y", p_float_t(xy.y, 1));
+        print_signed_float(F("r"), cal.residual(i));
+        SERIAL_EOL();
+      }
+    }
+
+    SERIAL_ECHOPGM("Calibration OK  iterations:", iterations);
+    SERIAL_ECHO_SP(14);
+    SERIAL_ECHOLNPGM("std dev:", p_float_t(rms_after, 3), "  max:", p_float_t(cal.max_residual(), 3));
+
+    MString<21> msg(F("Calibration sd:"));
+    if (rms_after < 1)
+      msg.appendf(F("0.%03i"), (int)LROUND(rms_after * 1000.0f));
+    else
+      msg.appendf(F("%03i.x"), (int)LROUND(rms_after));
+    ui.set_status(msg);
+    print_calibration_settings(true, towers_set);
+    SERIAL_ECHOLNPGM(".Diagonal rod:", delta_diagonal_rod);
+    SERIAL_ECHOLNPGM("Save with M500 and/or copy to Configuration.h");
+    return true;
+  }
+
+#endif // DELTA_CALIBRATION_LEAST_SQUARES
+
 static float auto_tune_h(const float dcr) {
   const float r_quot = dcr / delta_radius;
   return RECIPROCAL(r_quot / (2.0f / 3.0f));  // (2/3)/CR
@@ -376,6 +435,11 @@ static float auto_tune_a(const float dcr) {
  *
  *   O   Probe at offsetted probe positions (this is wrong but it seems to work)
  *
+ * With DELTA_CALIBRATION_LEAST_SQUARES:
+ *   Ln  Probe the center and n rings of points (1-4, default 3) just once and fit the
+ *       endstops, radius, diagonal rod and tower angles (unless T) by least squares.
+ *       Pn, Cn.nn and Fn are not used. V0 reports the probe results only.
+ *
  * With SENSORLESS_PROBING:
  *   Use these flags to calibrate stall sensitivity: (e.g., `G33 P1 Y Z` to calibrate X only.)
  *   X   Don't activate stallguard on X.
@@ -427,6 +491,17 @@ void GcodeSuite::G33() {
 
   const bool stow_after_each = parser.seen_test('E');
 
+  #if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+    const bool least_squares = parser.seen('L');
+    const int8_t ls_rings = parser.intval('L', 3);
+    if (least_squares && !WITHIN(ls_rings, 1, DeltaCalibration::max_rings)) {
+      SERIAL_ECHOLNPGM(GCODE_ERR_MSG("(L)east squares rings implausible (1-4)."));
+      return;
+    }
+  #else
+    constexpr bool least_squares = false;
+  #endif
+
   #if HAS_DELTA_SENSORLESS_PROBING
     probe.test_sensitivity = { !parser.seen_test('X'), !parser.seen_test('Y'), !parser.seen_test('Z') };
     const bool do_save_offset_adj = parser.seen_test('S');
@@ -439,8 +514,8 @@ void GcodeSuite::G33() {
              _7p_9_center         = probe_points >= 8,
              _tower_results       = (_4p_calibration && towers_set) || probe_points >= 3,
              _opposite_results    = (_4p_calibration && !towers_set) || probe_points >= 3,
-             _endstop_results     = probe_points != 1 && probe_points != -1 && probe_points != 0,
-             _angle_results       = probe_points >= 3 && towers_set;
+             _endstop_results     = least_squares || (probe_points != 1 && probe_points != -1 && probe_points != 0),
+             _angle_results       = (least_squares || probe_points >= 3) && towers_set;
   int8_t iterations = 0;
   float test_precision,
         zero_std_dev = (verbose_level ? 999.0f : 0.0f), // 0.0 in dry-run mode : forced end
@@ -463,9 +538,9 @@ void GcodeSuite::G33() {
 
   print_calibration_settings(_endstop_results, _angle_results);
 
-  ac_setup(!_0p_calibration && !_1p_calibration);
+  ac_setup(least_squares || (!_0p_calibration && !_1p_calibration));
 
-  if (!_0p_calibration) ac_home();
+  if (least_squares || !_0p_calibration) ac_home();
 
   #if HAS_DELTA_SENSORLESS_PROBING
     if (verbose_level > 0 && do_save_offset_adj) {
@@ -485,6 +560,16 @@ void GcodeSuite::G33() {
     }
   #endif
 
+  #if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+    if (least_squares) {
+      if (!least_squares_calibration(dcr, ls_rings, towers_set, verbose_level, stow_after_each, probe_at_offset)) {
+        SERIAL_ECHOLNPGM("Correct delta settings with M665 and M666");
+        return ac_cleanup();
+      }
+      ac_home();
+    }
+    else
+  #endif
   do { // start iterations
 
     float z_at_pt[NPP + 1] = { 0.0f };
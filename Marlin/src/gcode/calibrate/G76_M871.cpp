@@ -313,6 +313,7 @@ void GcodeSuite::M871() {
   if (parser.seen('R')) {
     // Reset z-probe offsets to factory defaults
     ptc.clear_all_offsets();
+    TERN_(PTC_ONLINE_FIT, ptc.reset_model());
     SERIAL_ECHOLNPGM("Offsets reset to default.");
   }
   else if (parser.seen("BPE")) {
@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_ISR_PROFILING)
+
+#include "../gcode.h"
+#include "../../feature/isr_profiler.h"
+
+/**
+ * M101: Stepper ISR Profile
+ *
+ * Report the share of time spent in the Stepper ISR and, for the whole ISR
+ * and each of its phases, the number of calls, min / avg / max time in µs,
+ * and a histogram of times by powers of 2 of Stepper timer ticks.
+ *
+ * Times include any higher-priority interrupts that ran during the phase.
+ *
+ *   R  Reset the statistics without reporting
+ */
+void GcodeSuite::M101() {
+  if (parser.seen_test('R'))
+    isr_profiler.reset();
+  else
+    isr_profiler.report();
+}
+
+#endif // STEPPER_ISR_PROFILING
@@ -140,6 +140,7 @@ void GcodeSuite::M48() {
   // Move to the first point, deploy, and probe
   const float t = probe.probe_at_point(test_position, raise_after, verbose_level);
   bool probing_good = !isnan(t);
+  TERN_(ADAPTIVE_PROBING, uint16_t touches = probe.sample_count);
 
   if (probing_good) {
     randomSeed(millis());
@@ -229,6 +230,7 @@ void GcodeSuite::M48() {
 
       // Store the new sample
       sample_set[n] = pz;
+      TERN_(ADAPTIVE_PROBING, touches += probe.sample_count);
 
       // Keep track of the largest and smallest samples
       NOMORE(min, pz);
@@ -258,6 +260,7 @@ void GcodeSuite::M48() {
   if (probing_good) {
     SERIAL_ECHOLNPGM("Finished!");
     dev_report(verbose_level > 0, mean, sigma, min, max, true);
+    TERN_(ADAPTIVE_PROBING, SERIAL_ECHOLNPGM("Probe touches: ", touches));
 
     #if HAS_STATUS_MESSAGE
       // Display M48 results in the status bar
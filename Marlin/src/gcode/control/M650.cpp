@@ -0,0 +1,49 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(LASER_RASTER)
+
+#include "../gcode.h"
+#include "../../feature/laser_raster.h"
+
+/**
+ * M650: Upload a laser raster line
+ *
+ *  M650 <pixels> - Append base64-encoded pixels to the line for the next powered G1.
+ *                  Each pixel is a power from 0 to 255, scaled by the G1's S power.
+ *  M650          - Discard the line.
+ *
+ * A line may take several M650 commands. The pixels are spread evenly
+ * along the G1, which should be a single straight move in inline mode (M3 I).
+ */
+void GcodeSuite::M650() {
+  if (!parser.string_arg || !*parser.string_arg) {
+    laser_raster.discard();
+    return;
+  }
+  if (!laser_raster.append_base64(parser.string_arg))
+    SERIAL_ERROR_MSG("Raster line over " STRINGIFY(LASER_RASTER_PIXELS) " pixels.");
+}
+
+#endif // LASER_RASTER
@@ -25,6 +25,9 @@
 #if ENABLED(FILAMENT_WIDTH_SENSOR)
 
 #include "../../../feature/filwidth.h"
+#if ENABLED(FILWIDTH_FLOW_COMPENSATION)
+  #include "../../../feature/flowcomp.h"
+#endif
 #include "../../../module/planner.h"
 #include "../../../MarlinCore.h"
 #include "../../gcode.h"
@@ -50,6 +53,7 @@ void GcodeSuite::M405() {
   if (parser.seenval('D'))
     filwidth.set_delay_cm(parser.value_byte());
 
+  TERN_(FILWIDTH_FLOW_COMPENSATION, if (!filwidth.enabled) flowcomp.reset());
   filwidth.enable(true);
 }
 
@@ -63,9 +67,15 @@ void GcodeSuite::M406() {
 
 /**
  * M407: Get measured filament diameter on serial output
+ *       With FILWIDTH_FLOW_COMPENSATION also report the width error and flow correction
+ *       since M405, and reset them with M407 R.
  */
 void GcodeSuite::M407() {
   SERIAL_ECHOLNPGM("Filament dia (measured mm):", filwidth.measured_mm);
+  #if ENABLED(FILWIDTH_FLOW_COMPENSATION)
+    flowcomp.report();
+    if (parser.seen_test('R')) flowcomp.reset_stats();
+  #endif
 }
 
 #endif // FILAMENT_WIDTH_SENSOR
@@ -572,6 +572,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 100: M100(); break;                                  // M100: Free Memory Report
       #endif
 
+      #if ENABLED(STEPPER_ISR_PROFILING)
+        case 101: M101(); break;                                  // M101: Stepper ISR Profile
+      #endif
+
       #if ENABLED(BD_SENSOR)
         case 102: M102(); break;                                  // M102: Configure Bed Distance Sensor
       #endif
@@ -976,6 +980,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 605: M605(); break;                                  // M605: Set Dual X Carriage movement mode
       #endif
 
+      #if ENABLED(LASER_RASTER)
+        case 650: M650(); break;                                  // M650: Upload a laser raster line
+      #endif
+
       #if IS_KINEMATIC
         case 665: M665(); break;                                  // M665: Set Kinematics parameters
       #endif
@@ -96,7 +96,7 @@
  * M23  - Select SD file: "M23 /path/file.gco". (Requires SDSUPPORT)
  * M24  - Start/resume SD print. (Requires SDSUPPORT)
  * M25  - Pause SD print. (Requires SDSUPPORT)
- * M26  - Set SD position in bytes: "M26 S12345". (Requires SDSUPPORT)
+ * M26  - Set SD position in bytes: "M26 S12345", or to a layer: "M26 L12". (Requires SDSUPPORT. L requires SD_PRESCAN)
  * M27  - Report SD print status. (Requires SDSUPPORT)
  *        OR, with 'S<seconds>' set the SD status auto-report interval. (Requires AUTO_REPORT_SD_STATUS)
  *        OR, with 'C' get the current filename.
@@ -133,6 +133,7 @@
  * M92  - Set planner.settings.axis_steps_per_mm for one or more axes. (Requires EDITABLE_STEPS_PER_UNIT)
  *
  * M100 - Watch Free Memory (for debugging) (Requires M100_FREE_MEMORY_WATCHER)
+ * M101 - Report Stepper ISR timing. R to reset. (Requires STEPPER_ISR_PROFILING)
  *
  * M102 - Configure Bed Distance Sensor. (Requires BD_SENSOR)
  *
@@ -237,7 +238,7 @@
  * M404 - Display or set the Nominal Filament Width: "W<diameter>". (Requires FILAMENT_WIDTH_SENSOR)
  * M405 - Enable Filament Sensor flow control. "M405 D<delay_cm>". (Requires FILAMENT_WIDTH_SENSOR)
  * M406 - Disable Filament Sensor flow control. (Requires FILAMENT_WIDTH_SENSOR)
- * M407 - Display measured filament diameter in millimeters. (Requires FILAMENT_WIDTH_SENSOR)
+ * M407 - Display measured filament diameter in millimeters. "R" to reset flow compensation stats. (Requires FILAMENT_WIDTH_SENSOR)
  * M410 - Quickstop. Abort all planned moves.
  * M412 - Enable / Disable Filament Runout Detection. (Requires FILAMENT_RUNOUT_SENSOR)
  * M413 - Enable / Disable Power-Loss Recovery. (Requires POWER_LOSS_RECOVERY)
@@ -271,6 +272,7 @@
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
+ * M650 - Upload a laser raster line for the next powered G1: "M650 <base64 pixels>". (Requires LASER_RASTER)
  * M665 - Set delta configurations: "M665 H<delta height> L<diagonal rod> R<delta radius> S<segments/s> B<calibration radius> X<Alpha angle trim> Y<Beta angle trim> Z<Gamma angle trim> (Requires DELTA)
  *        Set SCARA configurations: "M665 S<segments-per-second> P<theta-psi-offset> T<theta-offset> Z<z-offset> (Requires MORGAN_SCARA or MP_SCARA)
  *        Set Polargraph draw area and belt length: "M665 S<segments-per-second> L<draw-area-left> R<draw-area-right> T<draw-area-top> B<draw-area-bottom> H<max-belt-length>"
@@ -340,6 +342,8 @@
  * M999 - Restart after being stopped by error
  *
  * D... - Custom Development G-code. Add hooks to 'gcode_D.cpp' for developers to test features. (Requires MARLIN_DEV_MODE)
+ *        D120 - Benchmark mesh Z correction. (Requires a mesh-based leveling system)
+ *        D121 - Benchmark kinematic segmentation. (Requires DELTA, SCARA, or POLAR)
  *        D576 - Set buffer monitoring options. (Requires BUFFER_MONITORING)
  *
  *** "T" Codes ***
@@ -751,6 +755,10 @@ private:
     static void M100();
   #endif
 
+  #if ENABLED(STEPPER_ISR_PROFILING)
+    static void M101();
+  #endif
+
   #if ENABLED(BD_SENSOR)
     static void M102();
   #endif
@@ -1166,6 +1174,10 @@ private:
     static void M605();
   #endif
 
+  #if ENABLED(LASER_RASTER)
+    static void M650();
+  #endif
+
   #if IS_KINEMATIC
     static void M665();
     static void M665_report(const bool forReplay=true);
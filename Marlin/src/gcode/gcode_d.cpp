@@ -38,6 +38,31 @@
 #include "../sd/cardreader.h"
 #include "../MarlinCore.h" // for kill
 
+#if HAS_MESH
+  #include "../feature/bedlevel/bedlevel.h"
+#endif
+
+#if ANY(DELTA, IS_SCARA, POLAR)
+  #include "../module/motion.h"
+  #include "../module/planner.h"
+
+  #define D121_CHORDS 24
+
+  // Get chord 'i' of D121 across the printable area, split into segments of
+  // about seg_mm. Each chord is run forth and back so stateful kinematics
+  // (e.g., POLAR angle unwrapping) end up where they began.
+  static uint16_t d121_chord(const uint8_t i, const_float_t seg_mm, xy_pos_t &start, xy_pos_t &step) {
+    const float r = (PRINTABLE_RADIUS) * 0.8f, a = RADIANS((i >> 1) * 30), b = a + RADIANS(150);
+    xy_pos_t p1 = { r * cosf(a), r * sinf(a) }, p2 = { r * cosf(b), r * sinf(b) };
+    if (i & 1) { const xy_pos_t t = p1; p1 = p2; p2 = t; }
+    const xy_pos_t dist = p2 - p1;
+    const uint16_t segments = _MAX(1, dist.magnitude() / seg_mm);
+    start = p1;
+    step = dist / float(segments);
+    return segments;
+  }
+#endif
+
 void dump_delay_accuracy_check();
 
 /**
@@ -245,6 +270,92 @@ void GcodeSuite::D(const int16_t dcode) {
 
     #endif // HAS_MEDIA
 
+    #if HAS_MESH
+
+      case 120: { // D120 Benchmark mesh Z correction
+        // Walk a serpentine raster over the bed, like a finely segmented
+        // print, calling get_z_correction at every S<mm> step.
+        const float step = _MAX(parser.floatval('S', 1.0f), 0.1f);
+        volatile float sink;
+        uint32_t count = 0;
+        bool fwd = true;
+        xy_pos_t pos;
+        const millis_t start_ms = millis();
+        for (pos.y = Y_MIN_POS; pos.y <= Y_MAX_POS; pos.y += step, fwd = !fwd) {
+          hal.watchdog_refresh();
+          for (float x = 0; x <= (X_MAX_POS) - (X_MIN_POS); x += step, ++count) {
+            pos.x = fwd ? (X_MIN_POS) + x : (X_MAX_POS) - x;
+            sink = bedlevel.get_z_correction(pos);
+          }
+        }
+        const millis_t ms = _MAX(millis() - start_ms, 1UL);
+        SERIAL_ECHOLNPGM("D120 ", count, " corrections in ", ms, " ms (", uint32_t(count * 1000ULL / ms), "/s)");
+        UNUSED(sink);
+      } break;
+
+    #endif // HAS_MESH
+
+    #if ANY(DELTA, IS_SCARA, POLAR)
+
+      case 121: { // D121 Benchmark kinematic segmentation
+        // Solve the inverse kinematics for S<mm> segments along chords across
+        // the printable area, as for segmented moves, and report segments/s.
+        // With DELTA_INCREMENTAL_IK also run the incremental tower heights
+        // and report the largest difference from the exact solution.
+        const float seg_mm = _MAX(parser.floatval('S', 0.5f), 0.05f);
+        xyz_pos_t raw = current_position;
+        xy_pos_t start, step;
+        uint32_t count = 0;
+        millis_t ms = millis();
+        for (uint8_t i = 0; i < D121_CHORDS; ++i) {
+          hal.watchdog_refresh();
+          const uint16_t segments = d121_chord(i, seg_mm, start, step);
+          raw.set(start.x, start.y);
+          for (uint16_t k = segments; k--; ++count) {
+            raw += step;
+            inverse_kinematics(raw);
+          }
+        }
+        ms = _MAX(millis() - ms, 1UL);
+        SERIAL_ECHOLNPGM("D121 Exact IK: ", count, " segments in ", ms, " ms (", uint32_t(count * 1000ULL / ms), "/s)");
+
+        #if ENABLED(DELTA_INCREMENTAL_IK)
+          DeltaSegmentIK segment_ik;
+          volatile float sink;
+          count = 0;
+          ms = millis();
+          for (uint8_t i = 0; i < D121_CHORDS; ++i) {
+            hal.watchdog_refresh();
+            const uint16_t segments = d121_chord(i, seg_mm, start, step);
+            segment_ik.begin(start, step);
+            for (uint16_t k = segments; k--; ++count) {
+              const abc_float_t &rise = segment_ik.next();
+              sink = rise.a + rise.b + rise.c;
+            }
+          }
+          ms = _MAX(millis() - ms, 1UL);
+          SERIAL_ECHOLNPGM("D121 Incremental IK: ", count, " segments in ", ms, " ms (", uint32_t(count * 1000ULL / ms), "/s)");
+          UNUSED(sink);
+
+          float max_error = 0;
+          for (uint8_t i = 0; i < D121_CHORDS; ++i) {
+            hal.watchdog_refresh();
+            const uint16_t segments = d121_chord(i, seg_mm, start, step);
+            segment_ik.begin(start, step);
+            raw.set(start.x, start.y);
+            for (uint16_t k = segments; k--;) {
+              raw += step;
+              inverse_kinematics(raw);
+              const abc_float_t &rise = segment_ik.next();
+              LOOP_ABC(t) NOLESS(max_error, ABS(delta[t] - (raw.z + rise[t])));
+            }
+          }
+          SERIAL_ECHOLNPGM("D121 Max error: ", p_float_t(max_error, 6), " mm");
+        #endif
+      } break;
+
+    #endif // DELTA || IS_SCARA || POLAR
+
     #if ENABLED(POSTMORTEM_DEBUGGING)
 
       case 451: { // Trigger all kind of faults to test exception catcher
@@ -242,6 +242,9 @@ void GcodeSuite::M115() {
     // MEATPACK Compression
     cap_line(F("MEATPACK"), SERIAL_IMPL.has_feature(port, SerialFeature::MeatPack));
 
+    // HEATSHRINK Compressed G-code frames
+    cap_line(F("HEATSHRINK"), SERIAL_IMPL.has_feature(port, SerialFeature::Compression));
+
     // CONFIG_EXPORT
     cap_line(F("CONFIG_EXPORT"), ENABLED(CONFIGURATION_EMBEDDING));
 
@@ -29,6 +29,10 @@
 #include "../../module/planner.h"
 #include "../../module/temperature.h"
 
+#if ENABLED(FTM_ARC_BLOCKS)
+  #include "../../module/ft_motion.h"
+#endif
+
 #if N_ARC_CORRECTION < 1
   #undef N_ARC_CORRECTION
   #define N_ARC_CORRECTION 1
@@ -214,6 +218,63 @@ void plan_arc(
   // Feedrate for the move, scaled by the feedrate multiplier
   const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
 
+  #if ENABLED(FTM_ARC_BLOCKS)
+    /**
+     * With FT Motion the trajectory is sampled in time, so the planner can take
+     * the whole arc as a single block and FT Motion can trace the true curve.
+     * Arcs are split into pieces up to 120° so the end of each piece is
+     * well-defined in steps and a half circle never ends on the axis it
+     * started on. Leveling needs chords to follow the mesh.
+     */
+    if (ftMotion.cfg.active && !TERN0(HAS_LEVELING, planner.leveling_active)) {
+      const uint8_t pieces = CEIL(abs_angular_travel / RADIANS(120));
+      const float inv_pieces = 1.0f / pieces;
+
+      block_arc_t arc;
+      arc.axis_p = axis_p;
+      arc.axis_q = axis_q;
+      arc.radius = radius;
+      arc.angle = angular_travel * inv_pieces;
+      const float start_angle = ATAN2(rvec.b, rvec.a);
+
+      PlannerHints hints;
+      hints.arc = &arc;
+      #if HAS_Z_AXIS
+        hints.millimeters = HYPOT(flat_mm, travel_L) * inv_pieces;
+      #else
+        hints.millimeters = flat_mm * inv_pieces;
+      #endif
+
+      xyze_pos_t raw = current_position;
+      for (uint8_t i = 1; i <= pieces; i++) {
+        arc.start_angle = start_angle + arc.angle * (i - 1);
+        if (i < pieces) {
+          const float f = i * inv_pieces, th = start_angle + angular_travel * f;
+          raw[axis_p] = center_P + radius * cos(th);
+          raw[axis_q] = center_Q + radius * sin(th);
+          ARC_LIJKUVWE_CODE(
+            raw[axis_l] = start_L + travel_L * f,
+            raw.i       = start_I + travel_I * f,
+            raw.j       = start_J + travel_J * f,
+            raw.k       = start_K + travel_K * f,
+            raw.u       = start_U + travel_U * f,
+            raw.v       = start_V + travel_V * f,
+            raw.w       = start_W + travel_W * f,
+            raw.e       = start_E + travel_E * f
+          );
+        }
+        else
+          raw = cart;
+
+        apply_motion_limits(raw);
+        if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints)) break;
+      }
+
+      current_position = cart;
+      return;
+    }
+  #endif
+
   // Get the ideal segment length for the move based on settings
   const float ideal_segment_mm = (
     #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
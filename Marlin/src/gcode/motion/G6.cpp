@@ -31,8 +31,16 @@
 
 /**
  * G6: Direct Stepper Move
+ *
+ *  P<count> - Use this many pages (1 to STEPPER_PAGES). Only while all pages are free.
  */
 void GcodeSuite::G6() {
+  if (parser.seenval('P')) {
+    if (!page_manager.set_page_count(parser.value_ushort()))
+      SERIAL_ERROR_MSG("Pages busy or out of range.");
+    SERIAL_ECHOLNPGM("pages:", page_manager.page_count());
+  }
+
   // TODO: feedrate support?
   if (parser.seen('R'))
     planner.last_page_step_rate = parser.value_ulong();
@@ -277,6 +277,7 @@ void GCodeParser::parse(char *p) {
     TERN_(HAS_STATUS_MESSAGE, case 117:)
     TERN_(HAS_RS485_SERIAL, case 485:)
     TERN_(GCODE_MACROS, case 810 ... 819:)
+    TERN_(LASER_RASTER, case 650:)
     case 118:
       string_arg = unescape_string(p);
       return;
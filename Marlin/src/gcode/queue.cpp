@@ -49,6 +49,10 @@ GCodeQueue queue;
   #include "../feature/repeat.h"
 #endif
 
+#if ENABLED(CANCEL_OBJECTS_SD_SKIP)
+  #include "../feature/cancel_object.h"
+#endif
+
 // Frequently used G-code strings
 PGMSTR(G28_STR, "G28");
 
@@ -404,6 +408,32 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return is_empty;                    // Inform the caller
 }
 
+#if ENABLED(DIRECT_STEPPING_MAIN_RX)
+
+  /**
+   * Called from idle() so pages keep coming in while a command waits, or the
+   * queue is full. A page can only start a line, so at the start of a line one
+   * character is read. A page goes to the page manager, and anything else starts
+   * the command line, which is left for get_serial_commands() to finish.
+   */
+  void GCodeQueue::receive_pages() {
+    if (TERN0(BINARY_FILE_TRANSFER, card.flag.binary_mode)) return;
+
+    for (uint8_t p = 0; p < NUM_SERIAL; ++p) {
+      page_manager.receive_bulk(p);               // Finish the page in progress
+
+      SerialState &serial = serial_state[p];
+      while (serial.count == 0 && serial.input_state == PS_NORMAL && serial_data_available(p)) {
+        const int c = read_serial(p);
+        if (c < 0) break;
+        if (page_manager.receive(p, c) || ISEOL(c)) continue; // Empty lines are skipped anyway
+        process_stream_char(c, serial.input_state, serial.line_buffer, serial.count);
+      }
+    }
+  }
+
+#endif
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
@@ -458,6 +488,9 @@ void GCodeQueue::get_serial_commands() {
         continue;
       }
 
+      // Direct stepping pages go to the page manager
+      if (TERN0(DIRECT_STEPPING_MAIN_RX, page_manager.receive(p, c))) continue;
+
       const char serial_char = (char)c;
       SerialState &serial = serial_state[p];
 
@@ -560,6 +593,116 @@ void GCodeQueue::get_serial_commands() {
 
 #if HAS_MEDIA
 
+  #if ENABLED(CANCEL_OBJECTS_SD_SKIP)
+
+    /**
+     * Is an M486 waiting in the queue? Then the SD reader may already be past
+     * the end of the canceled object, so it mustn't skip ahead.
+     */
+    static bool object_change_pending() {
+      const GCodeQueue::RingBuffer &rb = GCodeQueue::ring_buffer;
+      for (uint8_t i = rb.index_r, n = rb.length; n--; i = (i + 1) % BUFSIZE) {
+        const char * const cmd = rb.commands[i].buffer;
+        if (cmd[0] == 'M' && cmd[1] == '4' && cmd[2] == '8' && cmd[3] == '6' && !NUMERIC(cmd[4])) return true;
+      }
+      return false;
+    }
+
+    /**
+     * Skip the moves of a canceled object by scanning raw SD bytes instead of
+     * queueing and parsing every line. Stop at the first line that isn't a
+     * G0-G3 move, a comment, or blank, so M486 and anything else that changes
+     * state still runs normally.
+     *
+     * A skipped move can still change the feedrate and (absolute) E position,
+     * so the last F and E values are queued as one G1 that gets skipped in turn.
+     * With VARIABLE_G0_FEEDRATE the F of a G0 only sets the G0 feedrate, so the
+     * last one gets its own G0.
+     *
+     * Return true if any lines were skipped.
+     */
+    static bool skip_canceled_moves() {
+      constexpr uint8_t max_lines = 64;   // Lines to skip per call, to keep idle() going
+      constexpr uint8_t word_size = 16;
+
+      char last_f[word_size] = "", last_e[word_size] = "";
+      const bool keep_e = TERN0(HAS_EXTRUDERS, !gcode.axis_is_relative(E_AXIS));
+
+      #if ENABLED(VARIABLE_G0_FEEDRATE)
+        // Room for both the G0 and the G1
+        if (GCodeQueue::ring_buffer.length > BUFSIZE - 2) return false;
+        char last_g0_f[word_size] = "";
+      #endif
+
+      uint8_t lines = 0;
+      for (; lines < max_lines && !card.eof(); ++lines) {
+        const uint32_t line_start = card.getIndex();
+
+        int16_t c;
+        do c = card.get(); while (c == ' ');
+
+        // Only a G0, G1, G2, or G3 (not G10, G29, etc.) can be skipped
+        bool skip = true;
+        char *move_f = last_f;
+        if (c == 'G') {
+          const int16_t g = card.get();
+          c = card.get();
+          skip = WITHIN(g, '0', '3') && !NUMERIC(c) && c != '.';
+          TERN_(VARIABLE_G0_FEEDRATE, if (g == '0') move_f = last_g0_f);
+        }
+        else if (c >= 0 && c != ';' && !ISEOL(c))
+          skip = false;
+
+        // Collect the F and E values of the move, up to the end of the line
+        char line_f[word_size] = "", line_e[word_size] = "", *word = nullptr;
+        uint8_t len = 0;
+        for (bool comment = false; skip && c >= 0 && !ISEOL(c); c = card.get()) {
+          if (c == ';') comment = true;
+          if (comment) continue;
+          if (word) {
+            if (NUMERIC_SIGNED(c) || c == '.') {
+              if (len < word_size - 1) { word[len++] = c; word[len] = '\0'; }
+              else skip = false;                        // Too long for this scanner
+              continue;
+            }
+            word = nullptr;
+          }
+          if (c == 'F') { word = line_f; len = 0; }
+          else if (c == 'E' && keep_e) { word = line_e; len = 0; }
+        }
+
+        // Leave this line (including a read error) and the rest to the normal reader
+        if (!skip || (c < 0 && !card.eof())) { card.setIndex(line_start); break; }
+
+        if (*line_f) strcpy(move_f, line_f);
+        if (*line_e) strcpy(last_e, line_e);
+      }
+
+      if (!lines) return false;
+
+      #if ENABLED(VARIABLE_G0_FEEDRATE)
+        if (*last_g0_f) {
+          MString<MAX_CMD_SIZE> cmd(F("G0 F"), last_g0_f);
+          GCodeQueue::ring_buffer.enqueue(&cmd);
+        }
+      #endif
+
+      if (*last_f || *last_e) {
+        MString<MAX_CMD_SIZE> cmd(F("G1"));
+        if (*last_f) cmd.append(F(" F"), last_f);
+        if (*last_e) cmd.append(F(" E"), last_e);
+        GCodeQueue::ring_buffer.enqueue(&cmd);
+      }
+
+      // The next command starts after the skipped lines
+      TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+
+      if (card.eof()) card.fileHasFinished();
+      return true;
+    }
+
+  #endif // CANCEL_OBJECTS_SD_SKIP
+
   /**
    * Get lines from the SD Card until the command buffer is full
    * or until the end of the file is reached. Because this method
@@ -574,6 +717,13 @@ void GCodeQueue::get_serial_commands() {
 
     int sd_count = 0;
     while (!ring_buffer.full() && !card.eof()) {
+
+      #if ENABLED(CANCEL_OBJECTS_SD_SKIP)
+        // Skip ahead through a canceled object, a batch of lines at a time
+        if (!sd_count && sd_input_state == PS_NORMAL && cancelable.state.skipping && !object_change_pending() && skip_canceled_moves())
+          return;
+      #endif
+
       const int16_t n = card.get();
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
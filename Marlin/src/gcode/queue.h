@@ -186,6 +186,13 @@ public:
    */
   static void get_available_commands();
 
+  #if ENABLED(DIRECT_STEPPING_MAIN_RX)
+    /**
+     * Take direct stepping pages from the serial ports while the main loop is busy
+     */
+    static void receive_pages();
+  #endif
+
   /**
    * Send an "ok" message to the host, indicating
    * that a command was successfully processed.
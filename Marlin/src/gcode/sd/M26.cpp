@@ -29,9 +29,27 @@
 
 /**
  * M26: Set SD Card file index
+ *
+ *  S<pos>   : Byte position in the file
+ *  L<layer> : Start of the given layer, from 0 (Requires SD_PRESCAN)
  */
 void GcodeSuite::M26() {
-  if (card.isMounted() && parser.seenval('S'))
+  if (!card.isMounted()) return;
+
+  #if ENABLED(SD_PRESCAN)
+    if (parser.seenval('L')) {
+      file_index_layer_t rec;
+      if (card.isFileOpen() && file_index.get_layer(parser.value_ulong(), rec)) {
+        card.setIndex(rec.sdpos);
+        SERIAL_ECHO_MSG("Layer ", parser.value_ulong(), " Z", rec.z, " at byte ", rec.sdpos);
+      }
+      else
+        SERIAL_ERROR_MSG("Layer not indexed");
+      return;
+    }
+  #endif
+
+  if (parser.seenval('S'))
     card.setIndex(parser.value_long());
 }
 
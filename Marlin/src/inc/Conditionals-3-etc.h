@@ -454,6 +454,7 @@
   #undef Z_PROBE_LOW_POINT
   #undef MULTIPLE_PROBING
   #undef EXTRA_PROBING
+  #undef ADAPTIVE_PROBING
   #undef PROBE_OFFSET_ZMIN
   #undef PROBE_OFFSET_ZMAX
   #undef PAUSE_BEFORE_DEPLOY_STOW
@@ -655,6 +656,11 @@
   #endif
 #endif
 
+// Split leveled Cartesian moves where they cross mesh lines
+#if HAS_MESH && IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+  #define HAS_MESH_LINE_SPLITTING 1
+#endif
+
 #if DISABLED(DELTA)
   #undef DELTA_HOME_TO_SAFE_ZONE
 #endif
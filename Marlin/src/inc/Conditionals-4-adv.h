@@ -911,6 +911,9 @@
   #if ENABLED(MIXING_EXTRUDER)
     #define WATCH_ALL_RUNOUT_SENSORS
   #endif
+  #if ENABLED(TOOLCHANGE_QUEUED_MOVES)
+    #define HAS_SYNC_RUNOUT 1 // Queued tool-change E moves reset the sensor when they start
+  #endif
 #endif
 
 #if ANY(PTC_PROBE, PTC_BED, PTC_HOTEND)
@@ -1316,6 +1319,11 @@
   #ifndef PAGE_MANAGER
     #define PAGE_MANAGER SerialPageManager
   #endif
+  #ifndef __AVR__
+    #define DIRECT_STEPPING_MAIN_RX // Pages are read by the main loop, not the RX ISR
+  #endif
+#else
+  #undef DIRECT_STEPPING_COMPRESSION
 #endif
 
 #if    defined(SAFE_BED_LEVELING_START_X) || defined(SAFE_BED_LEVELING_START_Y) || defined(SAFE_BED_LEVELING_START_Z) \
@@ -1339,6 +1347,17 @@
   #undef SD_ABORT_ON_ENDSTOP_HIT
 #endif
 
+#if ENABLED(CANCEL_OBJECTS)
+  #ifndef CANCEL_OBJECTS_MAX
+    #define CANCEL_OBJECTS_MAX 32
+  #endif
+  #if !HAS_MEDIA
+    #undef CANCEL_OBJECTS_SD_SKIP
+  #endif
+#else
+  #undef CANCEL_OBJECTS_SD_SKIP
+#endif
+
 // Power Monitor sensors
 #if ANY(POWER_MONITOR_CURRENT, POWER_MONITOR_VOLTAGE)
   #define HAS_POWER_MONITOR 1
@@ -1398,10 +1417,14 @@
 
 #if !HAS_MULTI_SERIAL
   #undef MEATPACK_ON_SERIAL_PORT_2
+  #undef HEATSHRINK_ON_SERIAL_PORT_2
 #endif
 #if ANY(MEATPACK_ON_SERIAL_PORT_1, MEATPACK_ON_SERIAL_PORT_2)
   #define HAS_MEATPACK 1
 #endif
+#if ANY(HEATSHRINK_ON_SERIAL_PORT_1, HEATSHRINK_ON_SERIAL_PORT_2)
+  #define HAS_HEATSHRINK_STREAM 1
+#endif
 
 // AVR are (usually) too limited in resources to store the configuration into the binary
 #if ENABLED(CONFIGURATION_EMBEDDING) && !defined(FORCE_CONFIG_EMBED) && (defined(__AVR__) || !HAS_MEDIA || ANY(SDCARD_READONLY, DISABLE_M503))
@@ -211,6 +211,17 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
       static_assert(_test_etc_sample_res != 12.3f, "PTC_HOTEND_RES must be a whole number.");
     #endif
   #endif
+
+  #if ENABLED(PTC_ONLINE_FIT)
+    #if !HAS_BED_PROBE
+      #error "PTC_ONLINE_FIT requires a bed probe."
+    #elif !defined(PTC_FIT_POINTS) || !defined(PTC_FIT_MIN_DELTA)
+      #error "PTC_ONLINE_FIT requires PTC_FIT_POINTS and PTC_FIT_MIN_DELTA."
+    #elif !WITHIN(PTC_FIT_POINTS, 1, 255)
+      #error "PTC_FIT_POINTS must be between 1 and 255."
+    #endif
+    static_assert(PTC_FIT_MIN_DELTA > 0, "PTC_FIT_MIN_DELTA must be greater than 0.");
+  #endif
 #endif // HAS_PTC
 
 /**
@@ -1190,6 +1201,8 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
     #error "ENABLE_LEVELING_FADE_HEIGHT on DELTA requires AUTO_BED_LEVELING_BILINEAR or AUTO_BED_LEVELING_UBL."
   #elif ENABLED(DELTA_AUTO_CALIBRATION) && !(HAS_BED_PROBE || HAS_MARLINUI_MENU)
     #error "DELTA_AUTO_CALIBRATION requires a probe or LCD Controller."
+  #elif ENABLED(DELTA_CALIBRATION_LEAST_SQUARES) && DISABLED(DELTA_AUTO_CALIBRATION)
+    #error "DELTA_CALIBRATION_LEAST_SQUARES requires DELTA_AUTO_CALIBRATION."
   #elif ENABLED(DELTA_CALIBRATION_MENU) && !HAS_MARLINUI_MENU
     #error "DELTA_CALIBRATION_MENU requires an LCD Controller."
   #elif ABL_USES_GRID
@@ -1199,6 +1212,14 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
       #error "DELTA requires GRID_MAX_POINTS_X and GRID_MAX_POINTS_Y to be 3 or higher."
     #endif
   #endif
+  #if ENABLED(DELTA_INCREMENTAL_IK)
+    #if ENABLED(SKEW_CORRECTION)
+      #error "DELTA_INCREMENTAL_IK is incompatible with SKEW_CORRECTION."
+    #endif
+    static_assert(DELTA_IK_TOLERANCE > 0, "DELTA_IK_TOLERANCE must be greater than 0.");
+  #endif
+#elif ENABLED(DELTA_INCREMENTAL_IK)
+  #error "DELTA_INCREMENTAL_IK requires DELTA."
 #endif
 
 /**
@@ -1581,6 +1602,13 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
     #endif
   #endif
 
+  #if ENABLED(ADAPTIVE_PROBING)
+    #if !(EXTRA_PROBING > 0)
+      #error "ADAPTIVE_PROBING requires EXTRA_PROBING."
+    #endif
+    static_assert(ADAPTIVE_PROBING_TOLERANCE > 0, "ADAPTIVE_PROBING_TOLERANCE must be greater than 0.");
+  #endif
+
   static_assert(Z_PROBE_LOW_POINT <= 0, "Z_PROBE_LOW_POINT must be less than or equal to 0.");
 
   #if ENABLED(PROBE_ACTIVATION_SWITCH)
@@ -1648,6 +1676,14 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #elif ALL(UBL_HILBERT_CURVE, DELTA)
     #error "UBL_HILBERT_CURVE can only be used with a square / rectangular printable area."
   #endif
+  #if ENABLED(UBL_ADAPTIVE_PROBING)
+    #if !HAS_BED_PROBE
+      #error "UBL_ADAPTIVE_PROBING requires a bed probe."
+    #elif !WITHIN(UBL_ADAPTIVE_STRIDE, 2, 15)
+      #error "UBL_ADAPTIVE_STRIDE must be between 2 and 15."
+    #endif
+    static_assert(UBL_ADAPTIVE_TOLERANCE > 0, "UBL_ADAPTIVE_TOLERANCE must be greater than 0.");
+  #endif
 #elif ENABLED(MESH_BED_LEVELING)
   #if ENABLED(DELTA)
     #error "MESH_BED_LEVELING is not compatible with DELTA printers."
@@ -1689,6 +1725,12 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif
 
+#if ENABLED(MESH_CELL_COEFFICIENTS)
+  #if NONE(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    #error "MESH_CELL_COEFFICIENTS requires AUTO_BED_LEVELING_BILINEAR or AUTO_BED_LEVELING_UBL."
+  #endif
+#endif
+
 #if ENABLED(G29_RETRY_AND_RECOVER) && NONE(AUTO_BED_LEVELING_3POINT, AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR)
   #error "G29_RETRY_AND_RECOVER requires AUTO_BED_LEVELING_3POINT, LINEAR, or BILINEAR."
 #endif
@@ -1867,6 +1909,20 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif
 
+#if ENABLED(FILWIDTH_FLOW_COMPENSATION)
+  #if DISABLED(FILAMENT_WIDTH_SENSOR)
+    #error "FILWIDTH_FLOW_COMPENSATION requires FILAMENT_WIDTH_SENSOR."
+  #elif !WITHIN(FLOWCOMP_SEGMENT_MM, 1, 50)
+    #error "FLOWCOMP_SEGMENT_MM must be an integer from 1 to 50."
+  #elif !WITHIN(FLOWCOMP_MAX_CORRECTION, 1, 50)
+    #error "FLOWCOMP_MAX_CORRECTION must be from 1 to 50."
+  #elif defined(FLOWCOMP_ENCODER_MM) && DISABLED(FILAMENT_MOTION_SENSOR)
+    #error "FLOWCOMP_ENCODER_MM requires FILAMENT_MOTION_SENSOR."
+  #elif defined(FLOWCOMP_ENCODER_MM) && FILAMENT_SENSOR_EXTRUDER_NUM >= TERN(FILAMENT_SWITCH_AND_MOTION, NUM_MOTION_SENSORS, NUM_RUNOUT_SENSORS)
+    #error "FLOWCOMP_ENCODER_MM requires a motion sensor for FILAMENT_SENSOR_EXTRUDER_NUM."
+  #endif
+#endif
+
 /**
  * System Power Sensor
  */
@@ -2617,6 +2673,18 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #error "ENDSTOP_NOISE_THRESHOLD must be an integer from 2 to 7."
 #endif
 
+#if ENABLED(ENDSTOP_CAPTURE)
+  #ifndef CPU_32_BIT
+    #error "ENDSTOP_CAPTURE requires a 32-bit board."
+  #elif ANY(FT_MOTION, STEP_EVENT_STREAM, HAS_ZV_SHAPING)
+    #error "ENDSTOP_CAPTURE is not compatible with FT_MOTION, STEP_EVENT_STREAM, or INPUT_SHAPING_[XYZ]."
+  #elif DISABLED(ENDSTOP_INTERRUPTS_FEATURE) && !HAS_ENDSTOP_EDGE_TIME
+    #error "ENDSTOP_CAPTURE requires ENDSTOP_INTERRUPTS_FEATURE or a HAL with endstop edge capture."
+  #elif !WITHIN(ENDSTOP_CAPTURE_STEPS, 2, 255)
+    #error "ENDSTOP_CAPTURE_STEPS must be from 2 to 255."
+  #endif
+#endif
+
 /**
  * Emergency Command Parser
  */
@@ -2764,9 +2832,15 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
     #error "Either disable SDCARD_READONLY or disable BINARY_FILE_TRANSFER."
   #elif ENABLED(SDCARD_EEPROM_EMULATION)
     #error "Either disable SDCARD_READONLY or disable SDCARD_EEPROM_EMULATION."
+  #elif ENABLED(SD_PRESCAN)
+    #error "Either disable SDCARD_READONLY or disable SD_PRESCAN."
   #endif
 #endif
 
+#if ENABLED(SD_PRESCAN) && !HAS_MEDIA
+  #error "SD_PRESCAN requires SDSUPPORT."
+#endif
+
 #if ENABLED(SD_IGNORE_AT_STARTUP)
   #if ENABLED(POWER_LOSS_RECOVERY)
     #error "SD_IGNORE_AT_STARTUP is incompatible with POWER_LOSS_RECOVERY."
@@ -3803,6 +3877,10 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #error "X_AXIS_TWIST_COMPENSATION is incompatible with NOZZLE_AS_PROBE."
 #endif
 
+#if ENABLED(CANCEL_OBJECTS) && !WITHIN(CANCEL_OBJECTS_MAX, 1, 127)
+  #error "CANCEL_OBJECTS_MAX must be from 1 to 127."
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #if ENABLED(BACKUP_POWER_SUPPLY) && !PIN_EXISTS(POWER_LOSS)
     #error "BACKUP_POWER_SUPPLY requires a POWER_LOSS_PIN."
@@ -3884,6 +3962,17 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
                   "BACKLASH_COMPENSATION can only apply to " STRINGIFY(NORMAL_AXIS) " with your CORE system.");
     #endif
   #endif
+  #if ENABLED(BACKLASH_IN_STEPPER)
+    #ifndef BACKLASH_TAKEUP_FEEDRATE
+      #error "BACKLASH_IN_STEPPER requires BACKLASH_TAKEUP_FEEDRATE."
+    #elif ENABLED(CORE_BACKLASH)
+      #error "BACKLASH_IN_STEPPER is not compatible with CORE_BACKLASH."
+    #elif defined(BACKLASH_SMOOTHING_MM)
+      #error "BACKLASH_SMOOTHING_MM is not used with BACKLASH_IN_STEPPER."
+    #elif ANY(FT_MOTION, STEP_EVENT_STREAM)
+      #error "BACKLASH_IN_STEPPER is not compatible with FT_MOTION or STEP_EVENT_STREAM."
+    #endif
+  #endif
 #endif
 
 #if ENABLED(GRADIENT_MIX) && MIXING_VIRTUAL_TOOLS < 2
@@ -3977,6 +4066,17 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
         #error "LASER_POWER_TRAP requires SPINDLE_LASER_USE_PWM to function."
       #endif
     #endif
+    #if ENABLED(LASER_RASTER)
+      #if IS_KINEMATIC
+        #error "LASER_RASTER is not supported for kinematic machines."
+      #elif ANY(FT_MOTION, STEP_EVENT_STREAM, MOTION_CORE)
+        #error "LASER_RASTER is not compatible with FT_MOTION, STEP_EVENT_STREAM, or MOTION_CORE."
+      #elif !WITHIN(LASER_RASTER_LINES, 2, 16)
+        #error "LASER_RASTER_LINES must be from 2 to 16."
+      #elif !WITHIN(LASER_RASTER_PIXELS, 1, 1024)
+        #error "LASER_RASTER_PIXELS must be from 1 to 1024."
+      #endif
+    #endif
   #else
     #if SPINDLE_LASER_POWERUP_DELAY < 1
       #error "SPINDLE_LASER_POWERUP_DELAY must be greater than 0."
@@ -4168,6 +4268,8 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
  */
 #if ALL(HAS_MEATPACK, BINARY_FILE_TRANSFER)
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
+#elif ALL(HAS_HEATSHRINK_STREAM, BINARY_FILE_TRANSFER)
+  #error "Either enable HEATSHRINK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
 
 /**
@@ -4387,10 +4489,14 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
  * Direct Stepping requirements
  */
 #if ENABLED(DIRECT_STEPPING)
-  #if ENABLED(CPU_32_BIT)
-    #error "Direct Stepping is not supported on 32-bit boards."
+  #if ENABLED(CPU_32_BIT) && DISABLED(DIRECT_STEPPING_MAIN_RX)
+    #error "Direct Stepping is not supported on 32-bit boards without a page reader."
+  #elif ENABLED(DIRECT_STEPPING_MAIN_RX) && defined(RX_BUFFER_SIZE) && RX_BUFFER_SIZE > 0 && RX_BUFFER_SIZE < 256
+    #error "DIRECT_STEPPING on 32-bit boards requires an RX_BUFFER_SIZE of 256 or more."
   #elif !IS_FULL_CARTESIAN
     #error "Direct Stepping is incompatible with enabled kinematics."
+  #elif !WITHIN(STEPPER_PAGES, 4, 256) || STEPPER_PAGES % 4
+    #error "STEPPER_PAGES must be a multiple of 4 from 4 to 256."
   #endif
 #endif
 
@@ -4479,6 +4585,17 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #elif DISABLED(FTM_UNIFIED_BWS)
     #error "FT_MOTION requires FTM_UNIFIED_BWS to be enabled because FBS is not yet implemented."
   #endif
+  #if ENABLED(FTM_ARC_BLOCKS)
+    #if DISABLED(ARC_SUPPORT)
+      #error "FTM_ARC_BLOCKS requires ARC_SUPPORT."
+    #elif IS_KINEMATIC
+      #error "FTM_ARC_BLOCKS is not compatible with kinematic machines."
+    #elif ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX)
+      #error "FTM_ARC_BLOCKS is not compatible with CoreXY, CoreXZ, CoreYZ, or Markforged kinematics."
+    #elif ENABLED(SKEW_CORRECTION)
+      #error "FTM_ARC_BLOCKS is not compatible with SKEW_CORRECTION."
+    #endif
+  #endif
   #if !HAS_X_AXIS
     static_assert(FTM_DEFAULT_SHAPER_X != ftMotionShaper_NONE, "Without any linear axes FTM_DEFAULT_SHAPER_X must be ftMotionShaper_NONE.");
   #endif
@@ -4488,11 +4605,67 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #if HAS_DYNAMIC_FREQ_G
     static_assert(FTM_DEFAULT_DYNFREQ_MODE != dynFreqMode_MASS_BASED, "dynFreqMode_MASS_BASED requires an X axis and an extruder.");
   #endif
+#elif ENABLED(FTM_ARC_BLOCKS)
+  #error "FTM_ARC_BLOCKS requires FT_MOTION."
 #endif
 
 // Multi-Stepping Limit
 static_assert(WITHIN(MULTISTEPPING_LIMIT, 1, 128) && IS_POWER_OF_2(MULTISTEPPING_LIMIT), "MULTISTEPPING_LIMIT must be 1, 2, 4, 8, 16, 32, 64, or 128.");
 
+// Step Event Stream
+#if ENABLED(STEP_EVENT_STREAM)
+  #ifndef CPU_32_BIT
+    #error "STEP_EVENT_STREAM requires a 32-bit MCU."
+  #elif ANY(FT_MOTION, I2S_STEPPER_STREAM)
+    #error "STEP_EVENT_STREAM is not compatible with FT_MOTION or I2S_STEPPER_STREAM."
+  #elif ANY(LIN_ADVANCE, HAS_ZV_SHAPING, BABYSTEPPING, DIRECT_STEPPING, MIXING_EXTRUDER)
+    #error "STEP_EVENT_STREAM is not yet compatible with LIN_ADVANCE, INPUT_SHAPING_*, BABYSTEPPING, DIRECT_STEPPING, or MIXING_EXTRUDER."
+  #elif E_STEPPERS > 1
+    #error "STEP_EVENT_STREAM does not yet support multiple E steppers."
+  #elif ENABLED(OLD_ADAPTIVE_MULTISTEPPING)
+    #error "STEP_EVENT_STREAM is not compatible with OLD_ADAPTIVE_MULTISTEPPING."
+  #elif ENABLED(ENDSTOP_INTERRUPTS_FEATURE)
+    #error "STEP_EVENT_STREAM is not compatible with ENDSTOP_INTERRUPTS_FEATURE."
+  #elif ANY(LASER_FEATURE, Z_LATE_ENABLE)
+    #error "STEP_EVENT_STREAM is not compatible with LASER_FEATURE or Z_LATE_ENABLE. Both act when a block starts, ahead of its steps."
+  #endif
+  static_assert(WITHIN(STEP_EVENT_BUFFER_SIZE, 16, 4096) && IS_POWER_OF_2(STEP_EVENT_BUFFER_SIZE), "STEP_EVENT_BUFFER_SIZE must be a power of 2 from 16 to 4096.");
+#endif
+
+// Step Pulse Train
+#if ENABLED(STEP_PULSE_TRAIN)
+  #ifndef HAL_PULSE_TRAIN
+    #error "STEP_PULSE_TRAIN is not supported by this HAL."
+  #elif ANY(STEP_EVENT_STREAM, I2S_STEPPER_STREAM)
+    #error "STEP_PULSE_TRAIN is not compatible with STEP_EVENT_STREAM or I2S_STEPPER_STREAM."
+  #elif !WITHIN(STEP_PULSE_TRAIN_RAMP, 16, 64)
+    #error "STEP_PULSE_TRAIN_RAMP must be from 16 to 64. The ramps are timed in the Stepper ISR."
+  #endif
+#endif
+
+// Motion Core
+#if ENABLED(MOTION_CORE)
+  #if !(defined(__PLAT_RP2040__) || defined(ARDUINO_ARCH_ESP32) || defined(__PLAT_LINUX__))
+    #error "MOTION_CORE requires a dual-core MCU (RP2040 or ESP32) or the LINUX HAL."
+  #elif ENABLED(DIRECT_STEPPING)
+    #error "MOTION_CORE is not compatible with DIRECT_STEPPING."
+  #elif ENABLED(FT_MOTION)
+    #error "MOTION_CORE is not compatible with FT_MOTION."
+  #elif ENABLED(STEP_EVENT_STREAM)
+    #error "MOTION_CORE is not compatible with STEP_EVENT_STREAM."
+  #elif ENABLED(LASER_RASTER)
+    #error "MOTION_CORE is not compatible with LASER_RASTER."
+  #elif ANY(LA_DEBUG, DEBUG_LASER_TRAP)
+    #error "MOTION_CORE is not compatible with LA_DEBUG or DEBUG_LASER_TRAP, which print from the planner."
+  #endif
+  static_assert(WITHIN(MOTION_CORE_QUEUE_SIZE, 4, 128) && IS_POWER_OF_2(MOTION_CORE_QUEUE_SIZE), "MOTION_CORE_QUEUE_SIZE must be a power of 2 from 4 to 128.");
+#endif
+
+// Stepper ISR Profiler times the phases with the Stepper timer, so they must run in the Stepper ISR
+#if ENABLED(STEPPER_ISR_PROFILING) && ANY(STEP_EVENT_STREAM, I2S_STEPPER_STREAM)
+  #error "STEPPER_ISR_PROFILING is not compatible with STEP_EVENT_STREAM or I2S_STEPPER_STREAM."
+#endif
+
 // One Click Print
 #if ENABLED(ONE_CLICK_PRINT)
   #if !HAS_MEDIA
@@ -307,6 +307,7 @@ private:
 
           bedlevel.z_values[i][j] = mz - lsf_results.D;
         }
+        bedlevel.refresh_bed_level();
         return false;
       }
 
@@ -3471,8 +3472,10 @@ void JyersDWIN::menuItemHandler(const uint8_t menu, const uint8_t item, bool dra
             case LEVELING_SETTINGS_ZERO:
               if (draw)
                 drawMenuItem(row, ICON_Mesh, F("Mesh Zero"));
-              else
+              else {
                 ZERO(bedlevel.z_values);
+                bedlevel.refresh_bed_level();
+              }
               break;
             case LEVELING_SETTINGS_UNDEF:
               if (draw)
@@ -3520,7 +3523,7 @@ void JyersDWIN::menuItemHandler(const uint8_t menu, const uint8_t item, bool dra
               drawMenuItem(row, ICON_Back, GET_TEXT_F(MSG_BACK));
             else {
               set_bed_leveling_enabled(level_state);
-              TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+              IF_DISABLED(MESH_BED_LEVELING, bedlevel.refresh_bed_level());
               drawMenu(ID_Leveling, LEVELING_MANUAL);
             }
             break;
@@ -118,6 +118,7 @@ bool drawing_mesh = false;
 
       bedlevel.z_values[i][j] = mz - lsf_results.D;
     }
+    bedlevel.refresh_bed_level();
     return false;
   }
 
@@ -172,7 +173,7 @@ void BedLevelTools::probeXY() {
 
 void BedLevelTools::meshReset() {
   ZERO(bedlevel.z_values);
-  TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+  IF_DISABLED(MESH_BED_LEVELING, bedlevel.refresh_bed_level());
 }
 
 // Accessors
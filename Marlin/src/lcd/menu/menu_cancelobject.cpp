@@ -34,13 +34,7 @@
 #include "../../feature/cancel_object.h"
 
 static void lcd_cancel_object_confirm() {
-  const int8_t v = MenuItemBase::itemIndex;
-  const char item_num[] = {
-    ' ',
-    char((v > 9) ? '0' + (v / 10) : ' '),
-    char('0' + (v % 10)),
-    '\0'
-  };
+  const char * const item_num = ui8tostr3rj(MenuItemBase::itemIndex);
   MenuItem_confirm::confirm_screen(
     []{
       cancelable.cancel_object(MenuItemBase::itemIndex);
@@ -0,0 +1,58 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * libs/heatshrink/heatshrink_stream.h
+ *
+ * The decompression stage shared by the serial decode pipeline
+ * and binary file transfer. Compressed data goes in and decoded
+ * data comes out a buffer at a time.
+ */
+#pragma once
+
+#include "heatshrink_decoder.h"
+
+class HeatshrinkStream {
+  heatshrink_decoder hsd;
+
+public:
+  // Start a new compressed stream
+  void reset() { heatshrink_decoder_reset(&hsd); }
+
+  // Take as much input as will fit. Return the number of bytes taken.
+  size_t sink(const uint8_t * const in, const size_t len) {
+    size_t count = 0;
+    heatshrink_decoder_sink(&hsd, const_cast<uint8_t*>(in), len, &count);
+    return count;
+  }
+
+  // Decode into the buffer. Return the number of bytes decoded.
+  // Less than 'room' means all the input taken so far is decoded.
+  size_t poll(uint8_t * const out, const size_t room) {
+    size_t count = 0;
+    if (room) heatshrink_decoder_poll(&hsd, out, room, &count);
+    return count;
+  }
+
+  // The stream has ended. Call poll again for any remaining output.
+  void finish() { heatshrink_decoder_finish(&hsd); }
+};
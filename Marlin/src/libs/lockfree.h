@@ -0,0 +1,118 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * lockfree.h - Lock-free handoff between two cores (or threads)
+ *
+ * Interrupt masking only protects data from code on the same core.
+ * These helpers use memory fences instead, so they also work when the
+ * producer and consumer run at the same time on different cores.
+ */
+
+#include <stdint.h>
+
+// Fences ordering memory accesses before and after, as seen by the other core
+inline void lf_acquire_fence() { __atomic_thread_fence(__ATOMIC_ACQUIRE); }
+inline void lf_release_fence() { __atomic_thread_fence(__ATOMIC_RELEASE); }
+inline void lf_full_fence()    { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+
+// Read or write a single value written by the other core
+template<typename T> inline T lf_load(const T &v) { return __atomic_load_n(&v, __ATOMIC_ACQUIRE); }
+template<typename T> inline void lf_store(T &v, const T val) { __atomic_store_n(&v, val, __ATOMIC_RELEASE); }
+
+// Change a value written by both cores
+template<typename T, typename N> inline void lf_add(T &v, const N n) { __atomic_fetch_add(&v, n, __ATOMIC_RELAXED); }
+template<typename T, typename N> inline void lf_sub(T &v, const N n) { __atomic_fetch_sub(&v, n, __ATOMIC_RELAXED); }
+
+/**
+ * @brief   Single-producer single-consumer queue
+ * @details Exactly one core may push and exactly one core may peek / pop.
+ *          An item is fully written before the consumer can see it, and
+ *          fully read before the producer can reuse its slot.
+ *          N must be a power of 2. One slot is kept free, so N-1 items fit.
+ */
+template<typename T, uint8_t N>
+class SPSCQueue {
+  static_assert(N >= 2 && !(N & (N - 1)), "SPSCQueue size must be a power of 2.");
+
+  T items[N];
+  uint8_t head = 0,   // Next slot to write. Written only by the producer.
+          tail = 0;   // Next slot to read. Written only by the consumer.
+
+  static constexpr uint8_t next(const uint8_t i) { return (i + 1) & (N - 1); }
+
+public:
+
+  // Producer: Add an item. Return false if the queue is full.
+  bool push(const T &item) {
+    const uint8_t h = head, n = next(h);
+    if (n == lf_load(tail)) return false;
+    items[h] = item;
+    lf_store(head, n);  // Publish the item
+    return true;
+  }
+
+  // Consumer: Get the oldest item without removing it. Return nullptr if the queue is empty.
+  T* peek() {
+    const uint8_t t = tail;
+    return t == lf_load(head) ? nullptr : &items[t];
+  }
+
+  // Consumer: Remove the oldest item, once it's no longer needed.
+  void pop() { lf_store(tail, next(tail)); }
+
+  // Either side
+  bool empty() const { return lf_load(head) == lf_load(tail); }
+  uint8_t count() const { return (lf_load(head) - lf_load(tail)) & (N - 1); }
+};
+
+/**
+ * @brief   Sequence lock for a value with one writer and any number of readers
+ * @details The writer never waits. A reader retries if the value changed
+ *          while it was being copied, so it never sees a half-written value.
+ */
+template<typename T>
+class SeqLock {
+  T value;
+  uint32_t seq = 0;   // Odd while a write is in progress
+
+public:
+
+  void write(const T &v) {
+    lf_store(seq, seq + 1);
+    lf_full_fence();
+    value = v;
+    lf_store(seq, seq + 1);
+  }
+
+  T read() const {
+    T v;
+    for (;;) {
+      const uint32_t s = lf_load(seq);
+      if (s & 1) continue;
+      v = value;
+      lf_acquire_fence();
+      if (__atomic_load_n(&seq, __ATOMIC_RELAXED) == s) return v;
+    }
+  }
+};
@@ -124,6 +124,51 @@ void inverse_kinematics(const xyz_pos_t &raw) {
   #endif
 }
 
+#if ENABLED(DELTA_INCREMENTAL_IK)
+
+  /**
+   * Get the exact heights at the current position and seed the differences
+   * from the derivatives per segment. With w the XY distance to the tower and
+   * s the height, s^2 = rod^2 - |w - k * step|^2 so that:
+   *   s'    = (w . step) / s
+   *   s''   = -(|step|^2 + s'^2) / s
+   *   s'''  = -3 * s' * s'' / s
+   *   s'''' = -(4 * s' * s''' + 3 * s''^2) / s
+   * The last one bounds the error of the cubic steps, giving the number of
+   * segments to go before the next exact evaluation.
+   */
+  void DeltaSegmentIK::exact() {
+    const float step2 = HYPOT2(step.x, step.y);
+    float d4_max = 0;
+    LOOP_ABC(t) {
+      const xy_float_t w = delta_tower[t] - pos;
+      const float s = SQRT(delta_diagonal_rod_2_tower[t] - HYPOT2(w.x, w.y)),
+                  inv_s = 1.0f / s,
+                  ds1 = (w.x * step.x + w.y * step.y) * inv_s,
+                  ds2 = -(step2 + sq(ds1)) * inv_s,
+                  ds3 = -3.0f * ds1 * ds2 * inv_s,
+                  ds4 = (4.0f * ds1 * ds3 + 3.0f * sq(ds2)) * inv_s;
+      rise[t] = s;
+      d1[t] = ds1 + ds2 * 0.5f + ds3 * RECIPROCAL(6.0f);
+      d2[t] = ds2 + ds3;
+      d3[t] = ds3;
+      NOLESS(d4_max, ABS(ds4));
+    }
+    // Error after n segments is about s'''' * n^4 / 24
+    const float n = d4_max ? SQRT(SQRT((24.0f * (DELTA_IK_TOLERANCE)) / d4_max)) : 255.0f;
+    countdown = n < 1.0f ? 1 : n > 255.0f ? 255 : uint8_t(n);
+  }
+
+  void DeltaSegmentIK::begin(const xy_pos_t &raw, const xy_pos_t &segment_distance) {
+    // Delta hotend offsets are applied in Cartesian space, as in inverse_kinematics
+    pos = raw;
+    TERN_(HAS_HOTEND_OFFSET, pos -= hotend_offset[active_extruder]);
+    step = segment_distance;
+    exact();
+  }
+
+#endif // DELTA_INCREMENTAL_IK
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
@@ -83,6 +83,40 @@ void recalc_delta_settings();
 
 void inverse_kinematics(const xyz_pos_t &raw);
 
+#if ENABLED(DELTA_INCREMENTAL_IK)
+
+  /**
+   * Incremental Delta Inverse Kinematics
+   *
+   * Along a straight line the height of each carriage above the effector,
+   * SQRT(rod^2 - distance^2), changes smoothly. So for a segmented move the
+   * heights are stepped from one segment to the next with (third order)
+   * forward differences, taking three additions per tower instead of a
+   * square root. The heights and differences are recalculated exactly as
+   * often as needed to keep the drift within DELTA_IK_TOLERANCE.
+   *
+   * Only XY is used here. Z (with any leveling) is added by the caller.
+   */
+  class DeltaSegmentIK {
+    xy_pos_t pos, step;             // XY of the current segment end, and XY per segment
+    abc_float_t rise, d1, d2, d3;   // Carriage heights above the effector and their forward differences
+    uint8_t countdown;              // Segments until the next exact evaluation
+    void exact();
+
+  public:
+    // Start at the given (raw) position with a fixed XY distance per segment
+    void begin(const xy_pos_t &raw, const xy_pos_t &segment_distance);
+
+    // Advance by one segment and get the carriage heights above the effector
+    const abc_float_t& next() {
+      pos += step;
+      if (--countdown) { rise += d1; d1 += d2; d2 += d3; } else exact();
+      return rise;
+    }
+  };
+
+#endif
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
@@ -0,0 +1,222 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * delta_calibration.cpp - Least-squares delta calibration
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+
+#include "delta_calibration.h"
+#include "delta.h"
+#include "motion.h"
+
+// The fitted factors, as changes from the settings at the start of the fit.
+// The C tower angle takes up the A and B changes so the towers can't all turn.
+enum Factor : uint8_t { F_EA, F_EB, F_EC, F_RADIUS, F_ROD, F_TA, F_TB, NUM_FACTORS };
+
+struct delta_settings_t {
+  abc_float_t endstop_adj, tower_angle_trim;
+  float radius, diagonal_rod;
+};
+
+static void apply_factors(const delta_settings_t &base, const float f[NUM_FACTORS]) {
+  delta_endstop_adj.set(base.endstop_adj.a + f[F_EA], base.endstop_adj.b + f[F_EB], base.endstop_adj.c + f[F_EC]);
+  delta_radius = base.radius + f[F_RADIUS];
+  delta_diagonal_rod = base.diagonal_rod + f[F_ROD];
+  delta_tower_angle_trim.set(base.tower_angle_trim.a + f[F_TA],
+                             base.tower_angle_trim.b + f[F_TB],
+                             base.tower_angle_trim.c - f[F_TA] - f[F_TB]);
+  recalc_delta_settings();
+}
+
+// Carriage heights at home less the endstop adjustments. Add a carriage
+// position (relative to the endstops) to get its height.
+static abc_float_t home_heights() {
+  inverse_kinematics(xyz_pos_t({ 0, 0, delta_height }));
+  abc_float_t home = delta;
+  return home - delta_endstop_adj;
+}
+
+static float bed_z(const abc_float_t &carriage, const abc_float_t &home) {
+  forward_kinematics(carriage + home);
+  return cartes.z;
+}
+
+xy_pos_t DeltaCalibration::point(const uint8_t index, const uint8_t rings, const_float_t radius) {
+  if (!index) return xy_pos_t({ 0, 0 });
+  // Find the ring, then the point on it, starting at the A tower
+  uint8_t ring = 1, first = 1;
+  while (index >= first + 6 * ring) first += 6 * ring++;
+  const float a = RADIANS(210 + 360.0f * (index - first) / (6 * ring)),
+              r = radius * ring / rings;
+  return xy_pos_t({ cos(a) * r, sin(a) * r });
+}
+
+void DeltaCalibration::add_point(const xy_pos_t &xy, const_float_t z) {
+  if (count >= max_points) return;
+  const abc_float_t home = home_heights();
+  inverse_kinematics(xyz_pos_t({ xy.x, xy.y, z }));
+  abc_float_t c = delta;
+  carriage[count++] = c - home;
+}
+
+float DeltaCalibration::residual(const uint8_t index) const {
+  return bed_z(carriage[index], home_heights());
+}
+
+float DeltaCalibration::rms() const {
+  if (!count) return 0;
+  const abc_float_t home = home_heights();
+  float s2 = 0;
+  for (uint8_t i = 0; i < count; ++i) s2 += sq(bed_z(carriage[i], home));
+  return SQRT(s2 / count);
+}
+
+float DeltaCalibration::max_residual() const {
+  const abc_float_t home = home_heights();
+  float m = 0;
+  for (uint8_t i = 0; i < count; ++i) NOLESS(m, ABS(bed_z(carriage[i], home)));
+  return m;
+}
+
+/**
+ * Solve M x = b by Gaussian elimination with partial pivoting.
+ * M and b are used up. Return false if M is singular.
+ */
+static bool solve_linear(float M[NUM_FACTORS][NUM_FACTORS], float b[NUM_FACTORS], const uint8_t n, float x[NUM_FACTORS]) {
+  for (uint8_t c = 0; c < n; ++c) {
+    uint8_t p = c;
+    for (uint8_t r = c + 1; r < n; ++r) if (ABS(M[r][c]) > ABS(M[p][c])) p = r;
+    if (ABS(M[p][c]) < 1e-12f) return false;
+    if (p != c) {
+      for (uint8_t k = 0; k < n; ++k) { const float t = M[c][k]; M[c][k] = M[p][k]; M[p][k] = t; }
+      const float t = b[c]; b[c] = b[p]; b[p] = t;
+    }
+    for (uint8_t r = c + 1; r < n; ++r) {
+      const float f = M[r][c] / M[c][c];
+      for (uint8_t k = c; k < n; ++k) M[r][k] -= f * M[c][k];
+      b[r] -= f * b[c];
+    }
+  }
+  for (uint8_t c = n; c--;) {
+    float s = b[c];
+    for (uint8_t k = c + 1; k < n; ++k) s -= M[c][k] * x[k];
+    x[c] = s / M[c][c];
+  }
+  return true;
+}
+
+/**
+ * Levenberg-Marquardt: with J the change in bed height at each point for a
+ * small change in each factor, and r the bed heights, step the factors by
+ * d where (JtJ + lambda * diag(JtJ)) d = -Jt r. Take the step if it makes
+ * the bed flatter and lower lambda (Gauss-Newton), otherwise raise lambda
+ * (gradient descent) and try again.
+ */
+uint8_t DeltaCalibration::fit(const bool tower_angles) {
+  constexpr uint8_t max_iterations = 30;
+  constexpr float diff = 0.01f;   // (mm or degrees) Factor change for the derivatives
+
+  const uint8_t n = tower_angles ? NUM_FACTORS : F_TA;
+  const delta_settings_t base = { delta_endstop_adj, delta_tower_angle_trim, delta_radius, delta_diagonal_rod };
+  float f[NUM_FACTORS] = { 0 }, lambda = 0.001f;
+
+  auto cost = [&](const float (&fac)[NUM_FACTORS]) {
+    apply_factors(base, fac);
+    const abc_float_t home = home_heights();
+    float s2 = 0;
+    for (uint8_t i = 0; i < count; ++i) s2 += sq(bed_z(carriage[i], home));
+    return s2;
+  };
+
+  float s2 = cost(f);
+  uint8_t iterations = 0;
+  while (count && iterations < max_iterations) {
+    ++iterations;
+
+    // Normal equations, a point at a time
+    float JtJ[NUM_FACTORS][NUM_FACTORS] = { { 0 } }, Jtr[NUM_FACTORS] = { 0 };
+    for (uint8_t i = 0; i < count; ++i) {
+      apply_factors(base, f);
+      const float r = bed_z(carriage[i], home_heights());
+      float J[NUM_FACTORS];
+      for (uint8_t k = 0; k < n; ++k) {
+        float g[NUM_FACTORS];
+        COPY(g, f);
+        g[k] += diff;
+        apply_factors(base, g);
+        J[k] = (bed_z(carriage[i], home_heights()) - r) / diff;
+      }
+      for (uint8_t j = 0; j < n; ++j) {
+        Jtr[j] += J[j] * r;
+        for (uint8_t k = 0; k < n; ++k) JtJ[j][k] += J[j] * J[k];
+      }
+    }
+
+    // Find a step that makes the bed flatter
+    bool better = false;
+    float step_max = 0;
+    while (!better && lambda < 1e6f) {
+      float M[NUM_FACTORS][NUM_FACTORS], b[NUM_FACTORS], d[NUM_FACTORS] = { 0 };
+      for (uint8_t j = 0; j < n; ++j) {
+        for (uint8_t k = 0; k < n; ++k) M[j][k] = JtJ[j][k];
+        M[j][j] *= 1.0f + lambda;
+        b[j] = -Jtr[j];
+      }
+      if (solve_linear(M, b, n, d)) {
+        float g[NUM_FACTORS];
+        step_max = 0;
+        for (uint8_t k = 0; k < NUM_FACTORS; ++k) { g[k] = f[k] + d[k]; NOLESS(step_max, ABS(d[k])); }
+        const float s2_new = cost(g);
+        if (s2_new < s2) {
+          better = true;
+          COPY(f, g);
+          s2 = s2_new;
+          lambda *= 0.1f;
+        }
+      }
+      if (!better) lambda *= 10.0f;
+    }
+
+    // Done when no step helps or the last one was tiny
+    if (!better || step_max < 0.0001f) break;
+  }
+
+  apply_factors(base, f);
+
+  // Move the highest endstop adjustment into the height, and center the tower angles
+  const float z_temp = _MAX(delta_endstop_adj.a, delta_endstop_adj.b, delta_endstop_adj.c);
+  const float a_mean = (delta_tower_angle_trim.a + delta_tower_angle_trim.b + delta_tower_angle_trim.c) / 3.0f;
+  delta_height -= z_temp;
+  LOOP_ABC(axis) {
+    delta_endstop_adj[axis] -= z_temp;
+    delta_tower_angle_trim[axis] -= a_mean;
+  }
+  recalc_delta_settings();
+
+  return iterations;
+}
+
+#endif // DELTA_CALIBRATION_LEAST_SQUARES
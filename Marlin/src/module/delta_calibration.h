@@ -0,0 +1,66 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * delta_calibration.h - Least-squares delta calibration
+ *
+ * The bed is probed once at a set of points using the current delta
+ * settings. Each result is kept as the distance of the carriages from
+ * their endstops, which doesn't depend on the settings. For any other
+ * settings forward_kinematics() then gives the height of the bed at each
+ * point, and the settings that make the bed flattest are found with
+ * Levenberg-Marquardt.
+ *
+ * Fitted: endstop adjustments, delta radius, diagonal rod and (optionally)
+ * the tower angle trims. The fit leaves the result in the delta settings.
+ */
+
+#include "../core/types.h"
+
+class DeltaCalibration {
+public:
+  static constexpr uint8_t max_rings = 4,
+                           max_points = 1 + 3 * max_rings * (max_rings + 1);
+
+  // The probe points: the center and rings of 6, 12, 18... points out to the radius
+  static constexpr uint8_t point_count(const uint8_t rings) { return 1 + 3 * rings * (rings + 1); }
+  static xy_pos_t point(const uint8_t index, const uint8_t rings, const_float_t radius);
+
+  DeltaCalibration() : count(0) {}
+
+  // Add a probed point (nozzle XY, bed Z) measured with the current delta settings
+  void add_point(const xy_pos_t &xy, const_float_t z);
+  uint8_t points() const { return count; }
+
+  // Bed height at a point, and the RMS and max of all points, with the current delta settings
+  float residual(const uint8_t index) const;
+  float rms() const;
+  float max_residual() const;
+
+  // Fit the delta settings to the points. Return the number of iterations.
+  uint8_t fit(const bool tower_angles);
+
+private:
+  uint8_t count;
+  abc_float_t carriage[max_points];   // Carriage distances below the endstops
+};
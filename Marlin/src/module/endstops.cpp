@@ -77,6 +77,15 @@ bool Endstops::enabled, Endstops::enabled_globally; // Initialized by settings.l
 volatile Endstops::endstop_mask_t Endstops::hit_state;
 Endstops::endstop_mask_t Endstops::live_state = 0;
 
+#if ENABLED(ENDSTOP_CAPTURE)
+  volatile uint32_t Endstops::edge_time; // = 0
+  bool Endstops::homing; // = false
+  // Without an input capture, the edge is when it's first seen
+  #ifndef ENDSTOP_EDGE_TIME
+    #define ENDSTOP_EDGE_TIME(P) micros()
+  #endif
+#endif
+
 #if ENABLED(BD_SENSOR)
   bool Endstops::bdp_state; // = false
   #if HOMING_Z_WITH_PROBE
@@ -271,12 +280,14 @@ void Endstops::enable_globally(const bool onoff) {
 // Enable / disable endstop checking
 void Endstops::enable(const bool onoff) {
   enabled = onoff;
+  TERN_(ENDSTOP_CAPTURE, homing = onoff);
   resync();
 }
 
 // Disable / Enable endstops based on ENSTOPS_ONLY_FOR_HOMING and global enable
 void Endstops::not_homing() {
   enabled = enabled_globally;
+  TERN_(ENDSTOP_CAPTURE, homing = false);
 }
 
 #if ENABLED(VALIDATE_HOMING_ENDSTOPS)
@@ -555,7 +566,16 @@ void Endstops::update() {
   // Macros to update / copy the live_state
   #define _ES_PIN(A,M) A##_##M##_PIN
   #define _ES_HIT(A,M) A##_##M##_ENDSTOP_HIT_STATE
-  #define UPDATE_LIVE_STATE(AXIS, MINMAX) SET_BIT_TO(live_state, ES_ENUM(AXIS, MINMAX), (READ_ENDSTOP(_ES_PIN(AXIS, MINMAX)) == _ES_HIT(AXIS, MINMAX)))
+  #if ENABLED(ENDSTOP_CAPTURE)
+    // Timestamp a new hit, before any debouncing
+    #define UPDATE_LIVE_STATE(AXIS, MINMAX) do{ \
+      const bool hit = READ_ENDSTOP(_ES_PIN(AXIS, MINMAX)) == _ES_HIT(AXIS, MINMAX); \
+      if (hit && !TEST(live_state, ES_ENUM(AXIS, MINMAX))) edge_time = ENDSTOP_EDGE_TIME(_ES_PIN(AXIS, MINMAX)); \
+      SET_BIT_TO(live_state, ES_ENUM(AXIS, MINMAX), hit); \
+    }while(0)
+  #else
+    #define UPDATE_LIVE_STATE(AXIS, MINMAX) SET_BIT_TO(live_state, ES_ENUM(AXIS, MINMAX), (READ_ENDSTOP(_ES_PIN(AXIS, MINMAX)) == _ES_HIT(AXIS, MINMAX)))
+  #endif
   #define COPY_LIVE_STATE(SRC_BIT, DST_BIT) SET_BIT_TO(live_state, DST_BIT, TEST(live_state, SRC_BIT))
 
   #if ENABLED(G38_PROBE_TARGET)
@@ -167,6 +167,13 @@ class Endstops {
   public:
     Endstops() {};
 
+    #if ENABLED(ENDSTOP_CAPTURE)
+      static volatile uint32_t edge_time;   // Time (µs) of the latest endstop edge
+      static bool homing;                   // Enabled for homing or probing, not just always on
+      // Step times are only worth recording when a trigger is expected
+      FORCE_INLINE static bool capture_enabled() { return homing || TERN0(HAS_BED_PROBE, z_probe_enabled) || TERN0(CALIBRATION_GCODE, calibration_probe_enabled); }
+    #endif
+
     /**
      * Initialize the endstop pins
      */
@@ -28,6 +28,10 @@
 #include "stepper.h" // Access stepper block queue function and abort status.
 #include "endstops.h"
 
+#if HAS_SYNC_RUNOUT
+  #include "../feature/runout.h"
+#endif
+
 FTMotion ftMotion;
 
 //-----------------------------------------------------------------
@@ -80,6 +84,10 @@ uint32_t FTMotion::N1,                          // Number of data points in the
 
 uint32_t FTMotion::max_intervals;               // Total number of data points that will be generated from block.
 
+#if ENABLED(FTM_ARC_BLOCKS)
+  FTMotion::ftm_arc_t FTMotion::arc;            // Arc data for the current block, if it is an arc.
+#endif
+
 // Make vector variables.
 uint32_t FTMotion::makeVector_idx = 0,          // Index of fixed time trajectory generation of the overall block.
          FTMotion::makeVector_batchIdx = 0;     // Index of fixed time trajectory generation within the batch.
@@ -139,6 +147,7 @@ void FTMotion::loop() {
     if (stepper.current_block->is_sync()) {     // Sync block?
       if (stepper.current_block->is_sync_pos()) // Position sync? Set the position.
         stepper._set_position(stepper.current_block->position);
+      TERN_(HAS_SYNC_RUNOUT, if (stepper.current_block->is_sync_runout()) runout.reset());
       discard_planner_block_protected();
       continue;
     }
@@ -475,6 +484,25 @@ void FTMotion::loadBlockData(block_t * const current_block) {
 
   ratio = moveDist * oneOverLength;
 
+  #if ENABLED(FTM_ARC_BLOCKS)
+    arc.active = current_block->is_arc();
+    if (arc.active) {
+      const block_arc_t &ba = current_block->arc;
+      arc.p = ba.axis_p;
+      arc.q = ba.axis_q;
+      arc.radius = ba.radius;
+      arc.start_angle = ba.start_angle;
+      arc.angle = ba.angle;
+      arc.inv_length = oneOverLength;
+      arc.center.set(startPosn[arc.p] - arc.radius * cosf(arc.start_angle),
+                     startPosn[arc.q] - arc.radius * sinf(arc.start_angle));
+      // The block ends on whole steps, which may be slightly off the circle
+      const float end_angle = arc.start_angle + arc.angle;
+      arc.closure.set(startPosn[arc.p] + moveDist[arc.p] - (arc.center.x + arc.radius * cosf(end_angle)),
+                      startPosn[arc.q] + moveDist[arc.q] - (arc.center.y + arc.radius * sinf(end_angle)));
+    }
+  #endif
+
   const float spm = totalLength / current_block->step_event_count;  // (steps/mm) Distance for each step
 
   f_s = spm * current_block->initial_rate;              // (steps/s) Start feedrate
@@ -604,6 +632,15 @@ void FTMotion::makeVector() {
   #define _SET_TRAJ(q) traj.q[makeVector_batchIdx] = startPosn.q + ratio.q * dist;
   LOGICAL_AXIS_MAP_LC(_SET_TRAJ);
 
+  #if ENABLED(FTM_ARC_BLOCKS)
+    // Trace the arc in its plane. The other axes move in proportion to the distance.
+    if (arc.active) {
+      const float f = dist * arc.inv_length, th = arc.start_angle + arc.angle * f;
+      traj.data[arc.p][makeVector_batchIdx] = arc.center.x + arc.radius * cosf(th) + arc.closure.x * f;
+      traj.data[arc.q][makeVector_batchIdx] = arc.center.y + arc.radius * sinf(th) + arc.closure.y * f;
+    }
+  #endif
+
   #if HAS_EXTRUDERS
     if (cfg.linearAdvEna) {
       float dedt_adj = (traj.e[makeVector_batchIdx] - e_raw_z1) * (FTM_FS);
@@ -157,6 +157,21 @@ class FTMotion {
     static uint32_t N1, N2, N3;
     static uint32_t max_intervals;
 
+    #if ENABLED(FTM_ARC_BLOCKS)
+      // Arc data for the current block
+      typedef struct {
+        bool active;              // The current block is an arc
+        AxisEnum p, q;            // Axes of the arc plane
+        float radius,             // (mm) Radius of the arc
+              start_angle,        // (rad) Angle of the start point from the center
+              angle,              // (rad) Angular travel
+              inv_length;         // (1/mm) Reciprocal of the block length
+        xy_float_t center,        // (mm) Center of the arc
+                   closure;       // (mm) Gap between the circle and the block end, closed along the arc
+      } ftm_arc_t;
+      static ftm_arc_t arc;
+    #endif
+
     // Number of batches needed to propagate the current trajectory to the stepper.
     static constexpr uint32_t PROP_BATCHES = CEIL((FTM_WINDOW_SIZE) / (FTM_BATCH_SIZE)) - 1;
 
@@ -71,12 +71,20 @@
 #endif
 
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
+#if ENABLED(PTC_ONLINE_FIT)
+  #include "../feature/probe_temp_comp.h"
+#endif
+
 #include "../core/debug_out.h"
 
 #if ENABLED(BD_SENSOR)
   #include "../feature/bedlevel/bdl/bdl.h"
 #endif
 
+#if ENABLED(MOTION_CORE)
+  #include "motion_core.h"
+#endif
+
 // Relative Mode. Enable with G91, disable with G90.
 bool relative_mode; // = false
 
@@ -258,7 +266,7 @@ void report_current_position() {
  */
 void report_current_position_projected() {
   report_logical_position(current_position);
-  stepper.report_a_position(planner.position);
+  stepper.report_a_position(TERN(MOTION_CORE, motion_core.position(), planner.position));
 }
 
 #if HAS_HOMING_CURRENT
@@ -1850,16 +1858,24 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
     // Get the current position as starting point
     xyze_pos_t raw = current_position;
 
+    #if ENABLED(DELTA_INCREMENTAL_IK)
+      // Step the tower heights along the line instead of solving each segment
+      DeltaSegmentIK segment_ik;
+      segment_ik.begin(raw, segment_distance);
+    #endif
+
     // Calculate and execute the segments
     millis_t next_idle_ms = millis() + 200UL;
     while (--segments) {
       segment_idle(next_idle_ms);
       raw += segment_distance;
+      TERN_(DELTA_INCREMENTAL_IK, hints.delta_rise = &segment_ik.next());
       if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
         break;
     }
 
     // Ensure last segment arrives at target location.
+    TERN_(DELTA_INCREMENTAL_IK, hints.delta_rise = nullptr);
     planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
 
     return false; // caller will update current_position
@@ -3074,6 +3090,7 @@ void set_axis_is_at_home(const AxisEnum axis) {
         #else
           current_position.z -= probe.offset.z;
         #endif
+        TERN_(PTC_ONLINE_FIT, ptc.z_homed());
         if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("*** Z homed with PROBE" TERN_(Z_MIN_PROBE_USES_Z_MIN_ENDSTOP_PIN, " (Z_MIN_PROBE_USES_Z_MIN_ENDSTOP_PIN)") " ***\n> (M851 Z", probe.offset.z, ")");
       #else
         if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("*** Z homed to ENDSTOP ***");
@@ -0,0 +1,173 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(MOTION_CORE)
+
+#include "motion_core.h"
+#include "../MarlinCore.h" // for idle()
+
+MotionCore motion_core;
+
+bool MotionCore::started, // = false
+     MotionCore::stop_requested; // = false
+uint8_t MotionCore::notices;
+
+SPSCQueue<motion_cmd_t, MOTION_CORE_QUEUE_SIZE> MotionCore::commands;
+SeqLock<abce_long_t> MotionCore::published_position;
+
+void MotionCore::start() {
+  published_position.write(planner.position);
+  started = true;
+  lf_full_fence();
+  hal.motion_core_start(task);
+}
+
+/**
+ * Hand a command to the motion core, waiting for room in the queue.
+ * Only called from the main core.
+ */
+void MotionCore::queue(const motion_cmd_t &cmd) {
+  while (!commands.push(cmd)) idle();
+}
+
+bool MotionCore::buffer_segment(const abce_pos_t &abce
+  OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
+  , const_feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints
+) {
+  // Refuse new moves while the planner is being cleared, like buffer_segment
+  if (lf_load(planner.cleaning_buffer_counter)) return false;
+
+  motion_cmd_t cmd;
+  cmd.type = MOTION_CMD_SEGMENT;
+  cmd.pos = abce;
+  TERN_(HAS_DIST_MM_ARG, cmd.cart_dist_mm = cart_dist_mm);
+  cmd.fr_mm_s = fr_mm_s;
+  cmd.extruder = extruder;
+  cmd.hints = hints;
+  TERN_(DELTA_INCREMENTAL_IK, cmd.hints.delta_rise = nullptr); // Only used by buffer_line
+
+  // The planner only refuses a move while it's being cleared, so don't wait for its answer.
+  // Only wait for room in the queue, and give up if a quick stop comes meanwhile.
+  while (!commands.push(cmd)) {
+    idle();
+    if (lf_load(planner.cleaning_buffer_counter)) return false;
+  }
+  return true;
+}
+
+void MotionCore::buffer_sync_block(const BlockFlagBit flag) {
+  motion_cmd_t cmd;
+  cmd.type = MOTION_CMD_SYNC;
+  cmd.sync_flag = flag;
+  queue(cmd);
+}
+
+void MotionCore::set_machine_position_mm(const abce_pos_t &abce) {
+  motion_cmd_t cmd;
+  cmd.type = MOTION_CMD_POSITION;
+  cmd.pos = abce;
+  queue(cmd);
+}
+
+void MotionCore::set_e_position_mm(const_float_t e) {
+  motion_cmd_t cmd;
+  cmd.type = MOTION_CMD_E_POSITION;
+  cmd.pos.e = e;
+  queue(cmd);
+}
+
+/**
+ * Wait for the motion core to drop everything. Called on the main core.
+ * The motion core checks for the request between commands, and a command
+ * waiting for a free block gives up once cleaning_buffer_counter is set.
+ */
+void MotionCore::quick_stop() {
+  lf_store(stop_requested, true);
+  while (lf_load(stop_requested)) { /* nada */ }
+}
+
+/**
+ * Print the messages posted by the motion core. Called on the main core.
+ */
+void MotionCore::report() {
+  if (!lf_load(notices)) return;
+  const uint8_t n = __atomic_exchange_n(&notices, 0, __ATOMIC_ACQUIRE);
+  if (TEST(n, MOTION_NOTE_COLD_EXTRUDE)) SERIAL_ECHO_MSG(STR_ERR_COLD_EXTRUDE_STOP);
+  if (TEST(n, MOTION_NOTE_LONG_EXTRUDE)) SERIAL_ECHO_MSG(STR_ERR_LONG_EXTRUDE_STOP);
+}
+
+/**
+ * Apply a command to the planner. Called on the motion core.
+ */
+void MotionCore::execute(motion_cmd_t &cmd) {
+  switch (cmd.type) {
+    case MOTION_CMD_SEGMENT:
+      planner.buffer_segment(cmd.pos OPTARG(HAS_DIST_MM_ARG, cmd.cart_dist_mm), cmd.fr_mm_s, cmd.extruder, cmd.hints);
+      break;
+    case MOTION_CMD_SYNC: planner.buffer_sync_block(cmd.sync_flag); break;
+    case MOTION_CMD_POSITION: planner.set_machine_position_mm(cmd.pos); break;
+    #if HAS_EXTRUDERS
+      case MOTION_CMD_E_POSITION: planner.set_e_position_mm(cmd.pos.e); break;
+    #endif
+    default: break;
+  }
+}
+
+/**
+ * Drop all commands and queued blocks for a quick stop. Called on the motion core
+ * while the main core holds off the Stepper ISR, so the buffer tail can't move.
+ */
+void MotionCore::service_stop() {
+  if (!lf_load(stop_requested)) return;
+
+  while (commands.peek()) commands.pop();
+
+  planner.clear_queued_blocks();
+
+  lf_store(stop_requested, false);
+}
+
+/**
+ * Wait for the Stepper ISR to free up blocks. Called on the motion core.
+ */
+void MotionCore::yield() {
+  hal.motion_core_yield();
+}
+
+/**
+ * The motion core loop, called repeatedly by the HAL on the motion core.
+ * A command leaves the queue only when it's done, so busy() stays true meanwhile.
+ */
+void MotionCore::task() {
+  service_stop();
+  if (motion_cmd_t * const cmd = commands.peek()) {
+    execute(*cmd);
+    published_position.write(planner.position);
+    commands.pop();
+  }
+  else
+    yield();
+}
+
+#endif // MOTION_CORE
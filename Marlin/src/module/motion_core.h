@@ -0,0 +1,125 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * motion_core.h - Run the planner on the second core of a dual-core MCU
+ *
+ * Threading contract:
+ *
+ *  - The main core runs G-code, temperature, UI, storage and the Stepper ISR.
+ *    It hands moves and position changes to the planner only through MotionCore's
+ *    command queue. Planner::buffer_segment, buffer_sync_block, set_machine_position_mm
+ *    and set_e_position_mm do this for any caller not on the motion core.
+ *    buffer_segment waits for the planner's answer, since callers act on it.
+ *
+ *  - The motion core is the only writer of the planner state and of the block
+ *    buffer head. It never calls idle() and never prints. Messages for the host
+ *    are posted with notify() and printed by the main core.
+ *
+ *  - The Stepper ISR is the only writer of the block buffer tail. A block is
+ *    claimed with a fence before its RECALCULATE flag is checked, the mirror
+ *    image of the planner, so they can't both use a block.
+ *
+ *  - Planner::quick_stop on the main core suspends the Stepper ISR and has the
+ *    motion core drop its commands and the queued blocks, waiting until it's done.
+ *
+ *  - planner.position is published for the main core after each command.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../libs/lockfree.h"
+#include "planner.h"
+
+enum MotionCommand : uint8_t {
+  MOTION_CMD_SEGMENT,     // Planner::buffer_segment
+  MOTION_CMD_SYNC,        // Planner::buffer_sync_block
+  MOTION_CMD_POSITION,    // Planner::set_machine_position_mm
+  MOTION_CMD_E_POSITION   // Planner::set_e_position_mm
+};
+
+// Messages from the motion core for the main core to print
+enum MotionNotice : uint8_t {
+  MOTION_NOTE_COLD_EXTRUDE,
+  MOTION_NOTE_LONG_EXTRUDE
+};
+
+typedef struct {
+  MotionCommand type;
+  uint8_t extruder;
+  BlockFlagBit sync_flag;
+  abce_pos_t pos;
+  #if HAS_DIST_MM_ARG
+    xyze_float_t cart_dist_mm;
+  #endif
+  feedRate_t fr_mm_s;
+  PlannerHints hints;
+} motion_cmd_t;
+
+class MotionCore {
+public:
+  static void start();
+
+  // Planner calls can run directly. Always true until start().
+  static bool is_current() { return !started || hal.on_motion_core(); }
+
+  // Commands waiting or in progress
+  static bool busy() { return !commands.empty(); }
+
+  // The planner.position for the most recent command
+  static abce_long_t position() { return published_position.read(); }
+
+  // Queue commands for the motion core. Wait only while the queue is full.
+  static bool buffer_segment(const abce_pos_t &abce
+    OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
+    , const_feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints
+  );
+  static void buffer_sync_block(const BlockFlagBit flag);
+  static void set_machine_position_mm(const abce_pos_t &abce);
+  static void set_e_position_mm(const_float_t e);
+
+  // Have the motion core drop all commands and queued blocks. Wait until it's done.
+  // Called by Planner::quick_stop with the Stepper ISR suspended.
+  static void quick_stop();
+
+  // Post a message from the motion core
+  static void notify(const MotionNotice n) { __atomic_fetch_or(&notices, uint8_t(_BV(n)), __ATOMIC_RELEASE); }
+
+  // Print the posted messages. Called by idle() on the main core.
+  static void report();
+
+  // Called on the motion core while it waits for the Stepper ISR
+  static void yield();
+
+private:
+  static bool started, stop_requested;
+  static uint8_t notices;
+  static SPSCQueue<motion_cmd_t, MOTION_CORE_QUEUE_SIZE> commands;
+  static SeqLock<abce_long_t> published_position;
+
+  static void queue(const motion_cmd_t &cmd);
+  static void execute(motion_cmd_t &cmd);
+  static void service_stop();
+  static void task();
+};
+
+extern MotionCore motion_core;
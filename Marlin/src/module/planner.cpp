@@ -72,6 +72,10 @@
 #if ENABLED(FT_MOTION)
   #include "ft_motion.h"
 #endif
+
+#if ENABLED(MOTION_CORE)
+  #include "motion_core.h"
+#endif
 #include "../lcd/marlinui.h"
 #include "../gcode/parser.h"
 
@@ -85,6 +89,10 @@
   #include "../feature/filwidth.h"
 #endif
 
+#if ENABLED(FILWIDTH_FLOW_COMPENSATION)
+  #include "../feature/flowcomp.h"
+#endif
+
 #if ENABLED(BARICUDA)
   #include "../feature/baricuda.h"
 #endif
@@ -113,6 +121,10 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(LASER_RASTER)
+  #include "../feature/laser_raster.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_NONE         0U
@@ -756,11 +768,21 @@ block_t* Planner::get_current_block() {
     // If we are here, there is no excuse to deliver the block
     block_t * const block = &block_buffer[block_buffer_tail];
 
-    // No trapezoid calculated? Don't execute yet.
-    if (block->flag.recalculate) return nullptr;
+    #if ENABLED(MOTION_CORE)
+      // The planner may be recalculating this block on the motion core. Claim the block
+      // before checking the flag, so either the planner sees it busy or we see the flag.
+      block_buffer_nonbusy = next_block_index(block_buffer_tail);
+      lf_full_fence();
+      if (block->flag.recalculate) { block_buffer_nonbusy = block_buffer_tail; return nullptr; }
+    #else
+      // No trapezoid calculated? Don't execute yet.
+      if (block->flag.recalculate) return nullptr;
+    #endif
 
     // We can't be sure how long an active block will take, so don't count it.
-    TERN_(HAS_WIRED_LCD, block_buffer_runtime_us -= block->segment_time_us);
+    #if HAS_WIRED_LCD
+      TERN(MOTION_CORE, lf_sub(block_buffer_runtime_us, block->segment_time_us), block_buffer_runtime_us -= block->segment_time_us);
+    #endif
 
     // As this block is busy, advance the nonbusy block pointer
     block_buffer_nonbusy = next_block_index(block_buffer_tail);
@@ -770,7 +792,9 @@ block_t* Planner::get_current_block() {
   }
 
   // The queue became empty
-  TERN_(HAS_WIRED_LCD, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
+  #if HAS_WIRED_LCD && DISABLED(MOTION_CORE) // With MOTION_CORE the next block may be counted already
+    clear_block_buffer_runtime(); // paranoia. Buffer is empty now - so reset accumulated time to zero.
+  #endif
 
   return nullptr;
 }
@@ -894,7 +918,7 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
      */
     if (cutter.cutter_mode == CUTTER_MODE_CONTINUOUS) {
       if (planner.laser_inline.status.isPowered && planner.laser_inline.status.isEnabled) {
-        if (block->laser.power > 0) {
+        if (block->laser.power > 0 && !TERN0(LASER_RASTER, block->laser.raster)) { // Raster lines set their own power
           NOLESS(block->laser.power, laser_power_floor);
           block->laser.trap_ramp_active_pwr = (block->laser.power - laser_power_floor) * (initial_rate / float(block->nominal_rate)) + laser_power_floor;
           block->laser.trap_ramp_entry_incr = (block->laser.power - block->laser.trap_ramp_active_pwr) / accelerate_steps;
@@ -1570,6 +1594,19 @@ void Planner::check_axes_activity() {
 
 void Planner::quick_stop() {
 
+  #if ENABLED(MOTION_CORE)
+    // The motion core owns the block buffer head, so it drops the queue while the Stepper ISR is held off
+    if (!motion_core.is_current()) {
+      // Make sure to drop any attempt of queuing moves for 1 second
+      lf_store(cleaning_buffer_counter, uint16_t(TEMP_TIMER_FREQUENCY));
+      const bool was_enabled = stepper.suspend();
+      motion_core.quick_stop();   // Returns once the motion core has called clear_queued_blocks()
+      if (was_enabled) stepper.wake_up();
+      stepper.quick_stop();
+      return;
+    }
+  #endif
+
   /**
    * Remove all the queued blocks.
    * NOTE: This function is NOT called from the Stepper ISR,
@@ -1581,15 +1618,7 @@ void Planner::quick_stop() {
 
   const bool was_enabled = stepper.suspend();
 
-  // Drop all queue entries
-  block_buffer_nonbusy = block_buffer_head = block_buffer_tail;
-
-  // Restart the block delay for the first movement - As the queue was
-  // forced to empty, there's no risk the ISR will touch this.
-
-  delay_before_delivering = TERN_(FT_MOTION, ftMotion.cfg.active ? BLOCK_DELAY_NONE :) BLOCK_DELAY_FOR_1ST_MOVE;
-
-  TERN_(HAS_WIRED_LCD, clear_block_buffer_runtime()); // Clear the accumulated runtime
+  clear_queued_blocks();
 
   // Make sure to drop any attempt of queuing moves for 1 second
   cleaning_buffer_counter = TEMP_TIMER_FREQUENCY;
@@ -1601,6 +1630,22 @@ void Planner::quick_stop() {
   stepper.quick_stop();
 }
 
+/**
+ * Drop all queue entries. The Stepper ISR must be suspended.
+ */
+void Planner::clear_queued_blocks() {
+  block_buffer_nonbusy = block_buffer_head = block_buffer_tail;
+
+  TERN_(LASER_RASTER, laser_raster.clear());
+
+  // Restart the block delay for the first movement - As the queue was
+  // forced to empty, there's no risk the ISR will touch this.
+
+  delay_before_delivering = TERN_(FT_MOTION, ftMotion.cfg.active ? BLOCK_DELAY_NONE :) BLOCK_DELAY_FOR_1ST_MOVE;
+
+  TERN_(HAS_WIRED_LCD, clear_block_buffer_runtime()); // Clear the accumulated runtime
+}
+
 #if ENABLED(REALTIME_REPORTING_COMMANDS)
 
   void Planner::quick_pause() {
@@ -1625,7 +1670,8 @@ void Planner::endstop_triggered(const AxisEnum axis) {
 }
 
 float Planner::triggered_position_mm(const AxisEnum axis) {
-  const float result = DIFF_TERN(BACKLASH_COMPENSATION, stepper.triggered_position(axis), backlash.get_applied_steps(axis));
+  const float result = DIFF_TERN(BACKLASH_COMPENSATION, stepper.triggered_position(axis), backlash.get_applied_steps(axis))
+                      + TERN0(ENDSTOP_CAPTURE, stepper.triggered_part(axis));
   return result * mm_per_step[axis];
 }
 
@@ -1634,11 +1680,16 @@ bool Planner::busy() {
       || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
       || TERN0(HAS_ZV_SHAPING, stepper.input_shaping_busy())
       || TERN0(FT_MOTION, ftMotion.busy)
+      || TERN0(STEP_EVENT_STREAM, stepper.step_stream_busy())
+      || TERN0(MOTION_CORE, motion_core.busy())
   );
 }
 
 void Planner::finish_and_disable() {
-  while (has_blocks_queued() || cleaning_buffer_counter) idle();
+  while (has_blocks_queued() || cleaning_buffer_counter
+    || TERN0(STEP_EVENT_STREAM, stepper.step_stream_busy())
+    || TERN0(MOTION_CORE, motion_core.busy())
+  ) idle();
   stepper.disable_all_steppers();
 }
 
@@ -1700,6 +1751,22 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
  */
 void Planner::synchronize() { while (busy()) idle(); }
 
+#if ENABLED(MOTION_CORE)
+
+  void Planner::await_moves_free(const uint8_t count) {
+    const bool on_motion_core = hal.on_motion_core();
+    while (moves_free() < count) {
+      if (!on_motion_core)
+        idle();
+      else if (lf_load(cleaning_buffer_counter))
+        break;                  // The caller checks cleaning_buffer_counter before using the block
+      else
+        motion_core.yield();
+    }
+  }
+
+#endif
+
 /**
  * @brief Add a new linear movement to the planner queue (in terms of steps).
  *
@@ -1751,7 +1818,8 @@ bool Planner::_buffer_steps(const xyze_long_t &target
     delay_before_delivering = TERN_(FT_MOTION, ftMotion.cfg.active ? BLOCK_DELAY_NONE :) BLOCK_DELAY_FOR_1ST_MOVE;
   }
 
-  // Move buffer head
+  // Move buffer head, after the block is complete
+  TERN_(MOTION_CORE, lf_release_fence());
   block_buffer_head = next_buffer_head;
 
   // find a speed from which the new block can stop safely
@@ -1836,7 +1904,7 @@ bool Planner::_populate_block(
           position.e = target.e; // Behave as if the move really took place, but ignore E part
           TERN_(HAS_POSITION_FLOAT, position_float.e = target_float.e);
           dist.e = 0; // no difference
-          SERIAL_ECHO_MSG(STR_ERR_COLD_EXTRUDE_STOP);
+          TERN(MOTION_CORE, motion_core.notify(MOTION_NOTE_COLD_EXTRUDE), SERIAL_ECHO_MSG(STR_ERR_COLD_EXTRUDE_STOP));
         }
       #endif // PREVENT_COLD_EXTRUSION
       #if ENABLED(PREVENT_LENGTHY_EXTRUDE)
@@ -1856,7 +1924,7 @@ bool Planner::_populate_block(
             position.e = target.e; // Behave as if the move really took place, but ignore E part
             TERN_(HAS_POSITION_FLOAT, position_float.e = target_float.e);
             dist.e = 0; // no difference
-            SERIAL_ECHO_MSG(STR_ERR_LONG_EXTRUDE_STOP);
+            TERN(MOTION_CORE, motion_core.notify(MOTION_NOTE_LONG_EXTRUDE), SERIAL_ECHO_MSG(STR_ERR_LONG_EXTRUDE_STOP));
           }
         }
       #endif // PREVENT_LENGTHY_EXTRUDE
@@ -1909,7 +1977,14 @@ bool Planner::_populate_block(
 
   #if HAS_EXTRUDERS
     dm.e = (dist.e > 0);
-    const float esteps_float = dist.e * e_factor[extruder];
+    #if ENABLED(FILWIDTH_FLOW_COMPENSATION)
+      float esteps_float = dist.e * e_factor[extruder];
+      // Scale printing moves for the filament being melted
+      if (extruder == FILAMENT_SENSOR_EXTRUDER_NUM && dist.e > 0 && (dist.a || dist.b))
+        esteps_float *= flowcomp.e_factor(esteps_float * mm_per_step[E_AXIS_N(extruder)]);
+    #else
+      const float esteps_float = dist.e * e_factor[extruder];
+    #endif
     const uint32_t esteps = ABS(esteps_float);
   #else
     constexpr uint32_t esteps = 0;
@@ -1927,6 +2002,7 @@ bool Planner::_populate_block(
    * only set by apply_power().
    */
   #if HAS_CUTTER
+    TERN_(LASER_RASTER, block->laser.raster = 0);
     switch (cutter.cutter_mode) {
       default: break;
 
@@ -2063,6 +2139,13 @@ bool Planner::_populate_block(
       block->millimeters = get_move_distance(displacement OPTARG(HAS_ROTATIONAL_AXES, cartesian_move));
     }
 
+    #if ENABLED(FTM_ARC_BLOCKS)
+      if (hints.arc) {
+        block->flag.apply(BLOCK_BIT_ARC);
+        block->arc = *hints.arc;
+      }
+    #endif
+
     /**
      * At this point at least one of the axes has more steps than
      * MIN_STEPS_PER_SEGMENT, ensuring the segment won't get dropped as
@@ -2072,7 +2155,9 @@ bool Planner::_populate_block(
      * A correction function is permitted to add steps to an axis, it
      * should *never* remove steps!
      */
-    TERN_(BACKLASH_COMPENSATION, backlash.add_correction_steps(dist, dm, block));
+    #if ENABLED(BACKLASH_COMPENSATION) && DISABLED(BACKLASH_IN_STEPPER)
+      backlash.add_correction_steps(dist, dm, block);
+    #endif
   }
 
   TERN_(HAS_EXTRUDERS, block->steps.e = esteps);
@@ -2092,6 +2177,12 @@ bool Planner::_populate_block(
   // Bail if this is a zero-length block
   if (block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
+  // A powered move takes the uploaded raster line. Not before the block is sure to be queued.
+  #if ENABLED(LASER_RASTER)
+    if (cutter.cutter_mode == CUTTER_MODE_CONTINUOUS && block->laser.status.isPowered)
+      block->laser.raster = laser_raster.attach();
+  #endif
+
   TERN_(MIXING_EXTRUDER, mixer.populate_block(block->b_color));
 
   #if HAS_FAN
@@ -2155,6 +2246,15 @@ bool Planner::_populate_block(
     );
   #endif
 
+  #if ENABLED(FTM_ARC_BLOCKS)
+    // An arc moves both plane axes, even one whose chord ends where it started
+    if (block->is_arc()) {
+      const AxisEnum p = block->arc.axis_p, q = block->arc.axis_q;
+      if (TERN1(Z_LATE_ENABLE, p != Z_AXIS)) stepper.enable_axis(p);
+      if (TERN1(Z_LATE_ENABLE, q != Z_AXIS)) stepper.enable_axis(q);
+    }
+  #endif
+
   // Enable extruder(s)
   #if HAS_EXTRUDERS
     if (esteps) {
@@ -2244,7 +2344,11 @@ bool Planner::_populate_block(
     }
   #endif
 
-  #if HAS_WIRED_LCD
+  #if HAS_WIRED_LCD && ENABLED(MOTION_CORE)
+    // The Stepper ISR runs on the other core, so suspending it won't protect the sum
+    block->segment_time_us = segment_time_us;
+    lf_add(block_buffer_runtime_us, segment_time_us);
+  #elif HAS_WIRED_LCD
     // Protect the access to the position.
     const bool was_enabled = stepper.suspend();
 
@@ -2259,7 +2363,7 @@ bool Planner::_populate_block(
 
   #if ENABLED(FILAMENT_WIDTH_SENSOR)
     if (extruder == FILAMENT_SENSOR_EXTRUDER_NUM)   // Only for extruder with filament sensor
-      filwidth.advance_e(dist_mm.e);
+      TERN(FILWIDTH_FLOW_COMPENSATION, flowcomp, filwidth).advance_e(dist_mm.e);
   #endif
 
   // Calculate and limit speed in mm/sec (linear) or degrees/sec (rotational)
@@ -2344,6 +2448,18 @@ bool Planner::_populate_block(
 
   #endif // XY_FREQUENCY_LIMIT
 
+  #if ENABLED(FTM_ARC_BLOCKS)
+    // Along an arc each plane axis may carry the full speed and acceleration,
+    // and the curvature limits the speed to keep centripetal acceleration in range.
+    float arc_accel = 0;
+    if (block->is_arc()) {
+      const AxisEnum p = block->arc.axis_p, q = block->arc.axis_q;
+      arc_accel = _MIN(settings.max_acceleration_mm_per_s2[p], settings.max_acceleration_mm_per_s2[q]);
+      const float max_fr = _MIN(settings.max_feedrate_mm_s[p], settings.max_feedrate_mm_s[q], SQRT(arc_accel * block->arc.radius));
+      if (block->nominal_speed > max_fr) NOMORE(speed_factor, max_fr / block->nominal_speed);
+    }
+  #endif
+
   // Correct the speed
   if (speed_factor < 1.0f) {
     current_speed *= speed_factor;
@@ -2434,6 +2550,8 @@ bool Planner::_populate_block(
         LIMIT_ACCEL_FLOAT(U_AXIS, 0), LIMIT_ACCEL_FLOAT(V_AXIS, 0), LIMIT_ACCEL_FLOAT(W_AXIS, 0)
       );
     }
+
+    TERN_(FTM_ARC_BLOCKS, if (arc_accel) NOMORE(accel, uint32_t(arc_accel * steps_per_mm)));
   }
   block->acceleration_steps_per_s2 = accel;
   block->acceleration = accel / steps_per_mm;
@@ -2526,6 +2644,16 @@ bool Planner::_populate_block(
      * => normalize the complete junction vector.
      * Elsewise, when needed JD will factor-in the E component
      */
+    #if ENABLED(FTM_ARC_BLOCKS)
+      // An arc meets its neighbors along the tangents at its ends
+      xyze_float_t arc_end_unit_vec;
+      if (block->is_arc()) {
+        arc_end_unit_vec = unit_vec;
+        block->arc.tangent(unit_vec, false, block->arc.planar_mm());
+        block->arc.tangent(arc_end_unit_vec, true, block->arc.planar_mm());
+      }
+    #endif
+
     if (ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX) || esteps > 0)
       normalize_junction_vector(unit_vec);  // Normalize with XYZE components
     else
@@ -2667,6 +2795,16 @@ bool Planner::_populate_block(
 
     prev_unit_vec = unit_vec;
 
+    #if ENABLED(FTM_ARC_BLOCKS)
+      if (block->is_arc()) {
+        if (esteps > 0)
+          normalize_junction_vector(arc_end_unit_vec);
+        else
+          arc_end_unit_vec *= inverse_millimeters;
+        prev_unit_vec = arc_end_unit_vec;
+      }
+    #endif
+
   #else // CLASSIC_JERK
 
     /**
@@ -2703,6 +2841,17 @@ bool Planner::_populate_block(
       previous_e_mm_per_step = mm_per_step[E_AXIS_N(extruder)];
     #endif
 
+    #if ENABLED(FTM_ARC_BLOCKS)
+      // An arc meets its neighbors along the tangents at its ends
+      xyze_float_t arc_end_speed;
+      if (block->is_arc()) {
+        const float planar_speed = block->arc.planar_mm() * block->nominal_speed * inverse_millimeters;
+        arc_end_speed = current_speed;
+        block->arc.tangent(current_speed, false, planar_speed);
+        block->arc.tangent(arc_end_speed, true, planar_speed);
+      }
+    #endif
+
     xyze_float_t speed_diff = current_speed;
     float vmax_junction;
     if (!moves_queued || UNEAR_ZERO(previous_nominal_speed)) {
@@ -2735,6 +2884,9 @@ bool Planner::_populate_block(
     }
     vmax_junction_sqr = sq(vmax_junction * v_factor);
 
+    // The next block meets the end of the arc
+    TERN_(FTM_ARC_BLOCKS, if (block->is_arc()) current_speed = arc_end_speed);
+
   #endif // CLASSIC_JERK
 
   // High acceleration limits override low jerk/junction deviation limits (as fixing trapezoids
@@ -2778,10 +2930,17 @@ bool Planner::_populate_block(
  */
 void Planner::buffer_sync_block(const BlockFlagBit sync_flag/*=BLOCK_BIT_SYNC_POSITION*/) {
 
+  #if ENABLED(MOTION_CORE)
+    if (!motion_core.is_current()) return motion_core.buffer_sync_block(sync_flag);
+  #endif
+
   // Wait for the next available block
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
 
+  // The motion core stops waiting for a free block if the buffer is being cleaned
+  if (TERN0(MOTION_CORE, lf_load(cleaning_buffer_counter))) return;
+
   // Clear block
   block->reset();
   block->flag.apply(sync_flag);
@@ -2812,9 +2971,11 @@ void Planner::buffer_sync_block(const BlockFlagBit sync_flag/*=BLOCK_BIT_SYNC_PO
     delay_before_delivering = TERN_(FT_MOTION, ftMotion.cfg.active ? BLOCK_DELAY_NONE :) BLOCK_DELAY_FOR_1ST_MOVE;
   }
 
+  TERN_(MOTION_CORE, lf_release_fence());
   block_buffer_head = next_buffer_head;
 
-  stepper.wake_up();
+  // The motion core leaves the Stepper ISR as the main core has it. It may be held off for a quick stop.
+  if (TERN1(MOTION_CORE, !hal.on_motion_core())) stepper.wake_up();
 } // buffer_sync_block()
 
 /**
@@ -2837,8 +2998,13 @@ bool Planner::buffer_segment(const abce_pos_t &abce
   , const PlannerHints &hints/*=PlannerHints()*/
 ) {
 
+  #if ENABLED(MOTION_CORE)
+    if (!motion_core.is_current())
+      return motion_core.buffer_segment(abce OPTARG(HAS_DIST_MM_ARG, cart_dist_mm), fr_mm_s, extruder, hints);
+  #endif
+
   // If we are cleaning, do not accept queuing of movements
-  if (cleaning_buffer_counter) return false;
+  if (TERN(MOTION_CORE, lf_load(cleaning_buffer_counter), cleaning_buffer_counter)) return false;
 
   // When changing extruders recalculate steps corresponding to the E position
   #if ENABLED(DISTINCT_E_FACTORS)
@@ -2943,7 +3109,8 @@ bool Planner::buffer_segment(const abce_pos_t &abce
       , fr_mm_s, extruder, hints
   )) return false;
 
-  stepper.wake_up();
+  // The motion core leaves the Stepper ISR as the main core has it. It may be held off for a quick stop.
+  if (TERN1(MOTION_CORE, !hal.on_motion_core())) stepper.wake_up();
   return true;
 } // buffer_segment()
 
@@ -2982,7 +3149,12 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
     #endif
 
     // Cartesian XYZ to kinematic ABC, stored in global 'delta'
-    inverse_kinematics(machine);
+    #if ENABLED(DELTA_INCREMENTAL_IK)
+      if (hints.delta_rise)
+        delta.set(machine.z + hints.delta_rise->a, machine.z + hints.delta_rise->b, machine.z + hints.delta_rise->c);
+      else
+    #endif
+        inverse_kinematics(machine);
 
     PlannerHints ph = hints;
     if (!hints.millimeters)
@@ -3121,6 +3293,10 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
  */
 void Planner::set_machine_position_mm(const abce_pos_t &abce) {
 
+  #if ENABLED(MOTION_CORE)
+    if (!motion_core.is_current()) return motion_core.set_machine_position_mm(abce);
+  #endif
+
   // When FT Motion is enabled, call synchronize() here instead of generating a sync block
   if (TERN0(FT_MOTION, ftMotion.cfg.active)) synchronize();
 
@@ -3141,7 +3317,8 @@ void Planner::set_machine_position_mm(const abce_pos_t &abce) {
     )
   );
 
-  if (has_blocks_queued()) {
+  // The motion core can't wait for the Stepper ISR, so it always sets the position with a sync block
+  if (has_blocks_queued() || TERN0(MOTION_CORE, hal.on_motion_core())) {
     //previous_nominal_speed = 0.0f; // Reset planner junction speeds. Assume start from rest.
     //previous_speed.reset();
     buffer_sync_block(BLOCK_BIT_SYNC_POSITION);
@@ -3184,6 +3361,10 @@ void Planner::set_position_mm(const xyze_pos_t &xyze) {
    * Special setter for planner E position (also setting E stepper position).
    */
   void Planner::set_e_position_mm(const_float_t e) {
+    #if ENABLED(MOTION_CORE)
+      if (!motion_core.is_current()) return motion_core.set_e_position_mm(e);
+    #endif
+
     const uint8_t axis_index = E_AXIS_N(active_extruder);
     TERN_(DISTINCT_E_FACTORS, last_extruder = active_extruder);
 
@@ -3193,7 +3374,7 @@ void Planner::set_position_mm(const xyze_pos_t &xyze) {
     TERN_(HAS_POSITION_FLOAT, position_float.e = e_new);
     TERN_(IS_KINEMATIC, TERN_(HAS_EXTRUDERS, position_cart.e = e));
 
-    if (has_blocks_queued())
+    if (has_blocks_queued() || TERN0(MOTION_CORE, hal.on_motion_core()))
       buffer_sync_block(BLOCK_BIT_SYNC_POSITION);
     else
       stepper.set_e_position(position.e);
@@ -3225,6 +3406,7 @@ void Planner::refresh_positioning() {
   #endif
   set_position_mm(current_position);
   refresh_acceleration_rates();
+  TERN_(BACKLASH_IN_STEPPER, backlash.refresh_takeup());
 }
 
 // Apply limits to a variable and give a warning if the value was out of range
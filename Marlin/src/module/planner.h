@@ -78,6 +78,10 @@
   #include "../feature/closedloop.h"
 #endif
 
+#if ENABLED(MOTION_CORE)
+  #include "../libs/lockfree.h"
+#endif
+
 // Feedrate for manual moves
 #ifdef MANUAL_FEEDRATE
   #define _RATE_MM_SEC(A) MMM_TO_MMS(manual_feedrate_mm_m.A),
@@ -123,6 +127,12 @@ enum BlockFlagBit {
 
   // Sync laser power from a queued block
   OPTARG(LASER_POWER_SYNC, BLOCK_BIT_LASER_PWR)
+
+  // The block is an arc traced by FT Motion
+  OPTARG(FTM_ARC_BLOCKS, BLOCK_BIT_ARC)
+
+  // Reset the filament runout sensor from a queued block
+  OPTARG(HAS_SYNC_RUNOUT, BLOCK_BIT_SYNC_RUNOUT)
 };
 
 /**
@@ -150,6 +160,14 @@ typedef struct {
       #if ENABLED(LASER_POWER_SYNC)
         bool sync_laser_pwr:1;
       #endif
+
+      #if ENABLED(FTM_ARC_BLOCKS)
+        bool arc:1;
+      #endif
+
+      #if HAS_SYNC_RUNOUT
+        bool sync_runout:1;
+      #endif
     };
   };
 
@@ -182,6 +200,10 @@ typedef struct {
     power_status_t status;                            // See planner settings for meaning
     uint8_t power;                                    // Ditto; When in trapezoid mode this is nominal power
 
+    #if ENABLED(LASER_RASTER)
+      uint8_t raster;                                 // Raster line + 1, or 0 for none. Pixels scale the power.
+    #endif
+
     #if ENABLED(LASER_POWER_TRAP)
       float trap_ramp_active_pwr;                     // Laser power level during active trapezoid smoothing
       float trap_ramp_entry_incr;                     // Acceleration per step laser power increment (trap entry)
@@ -191,6 +213,33 @@ typedef struct {
 
 #endif
 
+#if ENABLED(FTM_ARC_BLOCKS)
+
+  /**
+   * The arc of a G2/G3 move, traced in a single block by FT Motion.
+   * Any other axes move in proportion to the distance along the arc.
+   */
+  typedef struct {
+    AxisEnum axis_p, axis_q;  // Axes of the arc plane
+    float radius,             // (mm) Radius of the arc
+          start_angle,        // (rad) Angle of the start point from the center
+          angle;              // (rad) Angular travel, positive CCW
+
+    // (mm) Length of the arc in its plane
+    float planar_mm() const { return radius * ABS(angle); }
+
+    // Set the plane components of 'v' to the tangent at the start or end, with length 'len'
+    template<typename V>
+    void tangent(V &v, const bool at_end, const_float_t len) const {
+      const float th = at_end ? start_angle + angle : start_angle,
+                  l = angle < 0 ? -len : len;
+      v[axis_p] = -sinf(th) * l;
+      v[axis_q] = cosf(th) * l;
+    }
+  } block_arc_t;
+
+#endif
+
 /**
  * struct block_t
  *
@@ -207,8 +256,10 @@ typedef struct PlannerBlock {
   bool is_sync_pos() { return flag.sync_position; }
   bool is_sync_fan() { return TERN0(LASER_SYNCHRONOUS_M106_M107, flag.sync_fans); }
   bool is_sync_pwr() { return TERN0(LASER_POWER_SYNC, flag.sync_laser_pwr); }
-  bool is_sync() { return is_sync_pos() || is_sync_fan() || is_sync_pwr(); }
+  bool is_sync_runout() { return TERN0(HAS_SYNC_RUNOUT, flag.sync_runout); }
+  bool is_sync() { return is_sync_pos() || is_sync_fan() || is_sync_pwr() || is_sync_runout(); }
   bool is_page() { return TERN0(DIRECT_STEPPING, flag.page); }
+  bool is_arc() { return TERN0(FTM_ARC_BLOCKS, flag.arc); }
   bool is_move() { return !(is_sync() || is_page()); }
 
   // Fields used by the motion planner to manage acceleration
@@ -269,6 +320,10 @@ typedef struct PlannerBlock {
     page_idx_t page_idx;                    // Page index used for direct stepping
   #endif
 
+  #if ENABLED(FTM_ARC_BLOCKS)
+    block_arc_t arc;                        // Arc geometry, if flag.arc is set
+  #endif
+
   #if HAS_CUTTER
     cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
@@ -414,6 +469,14 @@ struct PlannerHints {
                                       // would calculate if it knew the as-yet-unbuffered path
   #endif
 
+  #if ENABLED(DELTA_INCREMENTAL_IK)
+    const abc_float_t *delta_rise = nullptr; // Carriage heights above the effector, if already known
+  #endif
+
+  #if ENABLED(FTM_ARC_BLOCKS)
+    const block_arc_t *arc = nullptr;   // Queue as an arc block with this geometry. 'millimeters' is required.
+  #endif
+
   #if HAS_ROTATIONAL_AXES
     bool cartesian_move = true;       // True if linear motion of the tool centerpoint relative to the workpiece occurs.
                                       // False if no movement of the tool center point relative to the work piece occurs
@@ -569,6 +632,10 @@ class Planner {
      */
     static uint32_t acceleration_long_cutoff;
 
+    #if ENABLED(UNIT_TEST)
+      friend class PlannerTest;   // Host tests of the planner math
+    #endif
+
     #ifdef MAX7219_DEBUG_SLOWDOWN
       friend class Max7219;
       static uint8_t slowdown_count;
@@ -810,6 +877,11 @@ class Planner {
     // Get count of movement slots free
     FORCE_INLINE static uint8_t moves_free() { return (BLOCK_BUFFER_SIZE) - 1 - movesplanned(); }
 
+    #if ENABLED(MOTION_CORE)
+      // Wait for free slots. On the motion core, stop waiting if the buffer is being cleaned.
+      static void await_moves_free(const uint8_t count);
+    #endif
+
     /**
      * @fn Planner::get_next_free_block
      *
@@ -821,7 +893,11 @@ class Planner {
     FORCE_INLINE static block_t* get_next_free_block(uint8_t &next_buffer_head, const uint8_t count=1) {
 
       // Wait until there are enough slots free
-      while (moves_free() < count) { idle(); }
+      #if ENABLED(MOTION_CORE)
+        await_moves_free(count);
+      #else
+        while (moves_free() < count) { idle(); }
+      #endif
 
       // Return the first available block
       next_buffer_head = next_block_index(block_buffer_head);
@@ -982,6 +1058,9 @@ class Planner {
     // a Full Shutdown is required, or when endstops are hit)
     static void quick_stop();
 
+    // Drop all queued blocks. Only with the Stepper ISR suspended.
+    static void clear_queued_blocks();
+
     #if ENABLED(REALTIME_REPORTING_COMMANDS)
       // Force a quick pause of the machine (e.g., when a pause is required in the middle of move).
       // NOTE: Hard-stops will lose steps so encoders are highly recommended if using these!
@@ -1028,8 +1107,10 @@ class Planner {
      * Called when the current block is no longer needed.
      */
     FORCE_INLINE static void release_current_block() {
-      if (has_blocks_queued())
+      if (has_blocks_queued()) {
+        TERN_(MOTION_CORE, lf_release_fence()); // Done with the block before the planner can reuse it
         block_buffer_tail = next_block_index(block_buffer_tail);
+      }
     }
 
     #if HAS_WIRED_LCD
@@ -34,6 +34,7 @@
 #include "motion.h"
 #include "temperature.h"
 #include "endstops.h"
+#include "planner.h"
 
 #include "../gcode/gcode.h"
 #include "../lcd/marlinui.h"
@@ -105,6 +106,11 @@ Probe probe;
 
 xyz_pos_t Probe::offset; // Initialized by settings.load
 
+#if ENABLED(ADAPTIVE_PROBING)
+  float Probe::sample_spread;
+  uint8_t Probe::sample_count;
+#endif
+
 #if HAS_PROBE_XY_OFFSET
   const xy_pos_t &Probe::offset_xy = Probe::offset;
 #endif
@@ -572,6 +578,13 @@ bool Probe::set_deployed(const bool deploy, const bool no_return/*=false*/) {
   return false;
 }
 
+#if ENABLED(ENDSTOP_CAPTURE) && !IS_KINEMATIC
+  static float probe_trigger_z;     // Z at the captured probe edge
+  #define PROBE_Z probe_trigger_z
+#else
+  #define PROBE_Z current_position.z
+#endif
+
 /**
  * @brief Move down until the probe triggers or the low limit is reached
  *        Used by run_z_probe to do a single Z probe move.
@@ -584,6 +597,8 @@ bool Probe::set_deployed(const bool deploy, const bool no_return/*=false*/) {
  *          Sets current_position.z to the height where the probe triggered
  *          (according to the Z stepper count). The float Z is propagated
  *          back to the planner.position to preempt any rounding error.
+ *          With ENDSTOP_CAPTURE the measured height (PROBE_Z) is where
+ *          the probe edge was captured, a little above where Z stopped.
  *
  * @return TRUE if the probe failed to trigger.
  */
@@ -694,6 +709,11 @@ bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
   // Tell the planner where we actually are
   sync_plan_position();
 
+  #if ENABLED(ENDSTOP_CAPTURE) && !IS_KINEMATIC
+    probe_trigger_z = current_position.z;
+    if (probe_triggered) probe_trigger_z -= planner.get_axis_position_mm(Z_AXIS) - planner.triggered_position_mm(Z_AXIS);
+  #endif
+
   return !probe_triggered;
 }
 
@@ -765,7 +785,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const_float_t z_min_p
 
     // Do a first probe at the fast speed
     const bool probe_fail = probe_down_to_z(z_probe_low_point, fr_mm_s),              // No probe trigger?
-               early_fail = (scheck && current_position.z > zoffs + error_tolerance); // Probe triggered too high?
+               early_fail = (scheck && PROBE_Z > zoffs + error_tolerance);            // Probe triggered too high?
     #if ENABLED(DEBUG_LEVELING_FEATURE)
       if (DEBUGGING(LEVELING) && (probe_fail || early_fail)) {
         DEBUG_ECHOPGM(" Probe fail! - ");
@@ -792,7 +812,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const_float_t z_min_p
     // Do a first probe at the fast speed
     if (try_to_probe(PSTR("FAST"), z_probe_low_point, z_probe_fast_mm_s, sanity_check)) return NAN;
 
-    const float z1 = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+    const float z1 = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, PROBE_Z, largest_sensorless_adj);
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("1st Probe Z:", z1);
 
     // Raise to give the probe clearance
@@ -814,6 +834,20 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const_float_t z_min_p
     float probes[TOTAL_PROBING];
   #endif
 
+  #if ENABLED(ADAPTIVE_PROBING)
+    // Find the MULTIPLE_PROBING sorted readings closest together. Return their spread.
+    auto closest_readings = [&](const uint8_t count, uint8_t &first) {
+      float spread = probes[MULTIPLE_PROBING - 1] - probes[0];
+      first = 0;
+      for (uint8_t i = 1; i + (MULTIPLE_PROBING) <= count; ++i) {
+        const float s = probes[i + (MULTIPLE_PROBING) - 1] - probes[i];
+        if (s < spread) { spread = s; first = i; }
+      }
+      return spread;
+    };
+    uint8_t readings = TOTAL_PROBING;
+  #endif
+
   #if TOTAL_PROBING > 2
     float probes_z_sum = 0;
     for (
@@ -834,7 +868,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const_float_t z_min_p
 
       TERN_(MEASURE_BACKLASH_WHEN_PROBING, backlash.measure_with_probe());
 
-      const float z = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+      const float z = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, PROBE_Z, largest_sensorless_adj);
 
       #if EXTRA_PROBING > 0
         // Insert Z measurement into probes[]. Keep it sorted ascending.
@@ -851,6 +885,15 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const_float_t z_min_p
         UNUSED(z);
       #endif
 
+      #if ENABLED(ADAPTIVE_PROBING)
+        // Done as soon as enough readings agree
+        uint8_t first;
+        if (p + 1 >= MULTIPLE_PROBING && closest_readings(p + 1, first) <= (ADAPTIVE_PROBING_TOLERANCE)) {
+          readings = p + 1;
+          break;
+        }
+      #endif
+
       #if TOTAL_PROBING > 2
         // Small Z raise after all but the last probe
         if (p
@@ -863,7 +906,18 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const_float_t z_min_p
 
   #if TOTAL_PROBING > 2
 
-    #if EXTRA_PROBING > 0
+    #if ENABLED(ADAPTIVE_PROBING)
+
+      // Average the readings that agree best and drop the rest
+      uint8_t first;
+      sample_spread = closest_readings(readings, first);
+      sample_count = readings;
+      for (uint8_t i = first; i < first + (MULTIPLE_PROBING); ++i)
+        probes_z_sum += probes[i];
+
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Readings:", readings, " Spread:", sample_spread);
+
+    #elif EXTRA_PROBING > 0
       // Take the center value (or average the two middle values) as the median
       static constexpr int PHALF = (TOTAL_PROBING - 1) / 2;
       const float middle = probes[PHALF],
@@ -885,7 +939,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const_float_t z_min_p
 
   #elif TOTAL_PROBING == 2
 
-    const float z2 = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+    const float z2 = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, PROBE_Z, largest_sensorless_adj);
 
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("2nd Probe Z:", z2, " Discrepancy:", z1 - z2);
 
@@ -895,7 +949,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const_float_t z_min_p
   #else
 
     // Return the single probe result
-    const float measured_z = current_position.z;
+    const float measured_z = PROBE_Z;
 
   #endif
 
@@ -1037,7 +1091,7 @@ float Probe::probe_at_point(
       #endif
     }
     else {
-      TERN_(HAS_PTC, ptc.apply_compensation(measured_z));
+      TERN_(HAS_PTC, ptc.apply_compensation(measured_z OPTARG(PTC_ONLINE_FIT, xy_pos_t(npos))));
       TERN_(X_AXIS_TWIST_COMPENSATION, measured_z += xatc.compensation(npos + offset_xy));
       if (verbose_level > 2 || DEBUGGING(LEVELING))
         SERIAL_ECHOLNPGM("Bed X: ", LOGICAL_X_POSITION(rx), " Y: ", LOGICAL_Y_POSITION(ry), " Z: ", measured_z);
@@ -87,6 +87,11 @@ public:
 
     static xyz_pos_t offset;
 
+    #if ENABLED(ADAPTIVE_PROBING)
+      static float sample_spread;   // Spread of the readings averaged at the last point
+      static uint8_t sample_count;  // Readings taken at the last point
+    #endif
+
     #if ANY(PREHEAT_BEFORE_PROBING, PREHEAT_BEFORE_LEVELING)
       static void preheat_for_probing(const celsius_t hotend_temp, const celsius_t bed_temp, const bool early=false);
     #endif
@@ -339,6 +339,9 @@ typedef struct SettingsDataStruct {
     #if ENABLED(PTC_HOTEND)
       int16_t z_offsets_hotend[COUNT(ptc.z_offsets_hotend)]; // M871 E I V
     #endif
+    #if ENABLED(PTC_ONLINE_FIT)
+      ptc_model_t ptc_model;                               // M871 R
+    #endif
   #endif
 
   //
@@ -723,7 +726,9 @@ void MarlinSettings::postprocess() {
 
   TERN_(ENABLE_LEVELING_FADE_HEIGHT, set_z_fade_height(new_z_fade_height, false)); // false = no report
 
-  TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+  #if ANY(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    bedlevel.refresh_bed_level();
+  #endif
 
   TERN_(HAS_MOTOR_CURRENT_PWM, stepper.refresh_motor_power());
 
@@ -1117,6 +1122,9 @@ void MarlinSettings::postprocess() {
       #if ENABLED(PTC_HOTEND)
         EEPROM_WRITE(ptc.z_offsets_hotend);
       #endif
+      #if ENABLED(PTC_ONLINE_FIT)
+        EEPROM_WRITE(ptc.model);
+      #endif
     #else
       // No placeholder data for this feature
     #endif
@@ -2199,6 +2207,10 @@ void MarlinSettings::postprocess() {
         #if ENABLED(PTC_HOTEND)
           EEPROM_READ(ptc.z_offsets_hotend);
         #endif
+        #if ENABLED(PTC_ONLINE_FIT)
+          EEPROM_READ(ptc.model);
+          if (!validating) ptc.init_fit();
+        #endif
         if (!validating) ptc.reset_index();
       #else
         // No placeholder data for this feature
@@ -3220,6 +3232,8 @@ void MarlinSettings::postprocess() {
             bedlevel.set_mesh_from_store(z_mesh_store, bedlevel.z_values);
         #endif
 
+        if (!into) bedlevel.refresh_bed_level();
+
         #if ENABLED(DWIN_LCD_PROUI)
           status = !bedLevelTools.meshValidate();
           if (status) {
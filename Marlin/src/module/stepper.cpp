@@ -116,6 +116,10 @@ Stepper stepper; // Singleton
   #include "../feature/babystep.h"
 #endif
 
+#if ENABLED(BACKLASH_IN_STEPPER)
+  #include "../feature/backlash.h"
+#endif
+
 #if MB(ALLIGATOR)
   #include "../feature/dac/dac_dac084s085.h"
 #endif
@@ -128,10 +132,14 @@ Stepper stepper; // Singleton
   #include "../feature/mixing.h"
 #endif
 
-#if HAS_FILAMENT_RUNOUT_DISTANCE
+#if ANY(HAS_FILAMENT_RUNOUT_DISTANCE, HAS_SYNC_RUNOUT)
   #include "../feature/runout.h"
 #endif
 
+#if ENABLED(FILWIDTH_FLOW_COMPENSATION)
+  #include "../feature/flowcomp.h"
+#endif
+
 #if ENABLED(AUTO_POWER_CONTROL)
   #include "../feature/power.h"
 #endif
@@ -152,6 +160,12 @@ Stepper stepper; // Singleton
   #include "../HAL/ESP32/i2s.h"
 #endif
 
+#if ENABLED(STEPPER_ISR_PROFILING)
+  #include "../feature/isr_profiler.h"
+#else
+  #define PROFILE_ISR_PHASE(P) NOOP
+#endif
+
 // public:
 
 #if ANY(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
@@ -297,19 +311,52 @@ uint32_t Stepper::advance_divisor = 0,
   hal_timer_t Stepper::nextBabystepISR = BABYSTEP_NEVER;
 #endif
 
+#if ENABLED(BACKLASH_IN_STEPPER)
+  hal_timer_t Stepper::nextBacklashISR = BACKLASH_NEVER;
+  xyz_long_t Stepper::backlash_applied{0}, Stepper::backlash_target{0};
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
   page_step_state_t Stepper::page_step_state;
 #endif
 
+#if ENABLED(STEP_PULSE_TRAIN)
+  PulseTrain Stepper::pulse_train;
+  AxisEnum Stepper::pulse_train_axis;
+  volatile bool Stepper::pulse_train_active, // = false
+                Stepper::pulse_train_cut;    // = false
+  uint32_t Stepper::pulse_train_wait; // = 0
+#endif
+
+#if ENABLED(LASER_RASTER)
+  uint16_t Stepper::raster_pixel;
+  uint32_t Stepper::raster_next_step;
+#endif
+
 hal_timer_t Stepper::ticks_nominal = 0;
 #if DISABLED(S_CURVE_ACCELERATION)
   uint32_t Stepper::acc_step_rate; // needed for deceleration start point
 #endif
 
 xyz_long_t Stepper::endstops_trigsteps;
+
+#if ENABLED(ENDSTOP_CAPTURE)
+  Stepper::step_time_t Stepper::step_history[ENDSTOP_CAPTURE_STEPS];
+  uint8_t Stepper::step_history_index, Stepper::step_history_count;
+  bool Stepper::capture_steps;
+  xyz_float_t Stepper::endstops_trigpart{0};
+#endif
 xyze_long_t Stepper::count_position{0};
 xyze_int8_t Stepper::count_direction{0};
 
+#if ENABLED(STEP_EVENT_STREAM)
+  step_event_t Stepper::step_events[STEP_EVENT_BUFFER_SIZE];
+  volatile uint16_t Stepper::step_event_head = 0, Stepper::step_event_tail = 0;
+  volatile uint32_t Stepper::step_ticks_queued = 0, Stepper::step_ticks_done = 0;
+  AxisBits Stepper::step_event_bits;
+  AxisBits Stepper::stream_set_direction, Stepper::stream_did_move;
+#endif
+
 #define MINDIR(A) (count_direction[_AXIS(A)] < 0)
 #define MAXDIR(A) (count_direction[_AXIS(A)] > 0)
 
@@ -659,7 +706,7 @@ void Stepper::disable_all_steppers() {
 // Set a single axis direction based on the last set flags.
 // A direction bit of "1" indicates forward or positive motion.
 #define SET_STEP_DIR(A) do{                     \
-    const bool fwd = motor_direction(_AXIS(A)); \
+    const bool fwd = last_direction_bits[_AXIS(A)]; \
     A##_APPLY_DIR(fwd, false);                  \
     count_direction[_AXIS(A)] = fwd ? 1 : -1;   \
   }while(0)
@@ -682,6 +729,7 @@ void Stepper::apply_directions() {
   );
 
   TERN_(FTM_OPTIMIZE_DIR_STATES, last_set_direction = last_direction_bits);
+  TERN_(STEP_EVENT_STREAM, stream_set_direction = last_direction_bits);
 
   DIR_WAIT_AFTER();
 }
@@ -1489,6 +1537,12 @@ void Stepper::apply_directions() {
       #endif
     }
   #endif
+
+  #if ENABLED(UNIT_TEST)
+    void Stepper::test_bezier_coeffs(const int32_t v0, const int32_t v1, const uint32_t av) { _calc_bezier_curve_coeffs(v0, v1, av); }
+    int32_t Stepper::test_bezier_eval(const uint32_t curr_step) { return _eval_bezier_curve(curr_step); }
+  #endif
+
 #endif // S_CURVE_ACCELERATION
 
 /**
@@ -1526,6 +1580,11 @@ void Stepper::isr() {
   // periods to big periods are respected and the timer does not reset to 0
   HAL_timer_set_compare(MF_TIMER_STEP, hal_timer_t(HAL_TIMER_TYPE_MAX));
 
+  #if ENABLED(STEP_PULSE_TRAIN)
+    // The pulse train was stopped early. Don't wait out the rest of it.
+    if (pulse_train_cut) { pulse_train_cut = false; nextMainISR = 0; }
+  #endif
+
   // Count of ticks for the next ISR
   hal_timer_t next_isr_ticks = 0;
 
@@ -1535,7 +1594,7 @@ void Stepper::isr() {
   #if ENABLED(FT_MOTION)
     static uint32_t ftMotion_nextAuxISR = 0U;  // Storage for the next ISR of the auxilliary tasks.
     const bool using_ftMotion = ftMotion.cfg.active;
-  #else
+  #elif DISABLED(STEP_EVENT_STREAM)
     constexpr bool using_ftMotion = false;
   #endif
 
@@ -1568,6 +1627,18 @@ void Stepper::isr() {
 
     #endif
 
+    #if ENABLED(STEP_EVENT_STREAM)
+
+      if (!nextMainISR) nextMainISR = step_stream_isr();  // Apply the next pre-computed step event
+
+      // Enable ISRs to reduce latency for higher priority ISRs, or all ISRs if no prioritization.
+      hal.isr_on();
+
+      interval = _MIN(nextMainISR, uint32_t(HAL_TIMER_TYPE_MAX));
+      nextMainISR -= interval;
+
+    #else
+
     if (!using_ftMotion) {
 
       TERN_(HAS_ZV_SHAPING, shaping_isr());               // Do Shaper stepping, if needed
@@ -1583,6 +1654,10 @@ void Stepper::isr() {
           nextAdvanceISR = la_interval;
       #endif
 
+      #if ENABLED(BACKLASH_IN_STEPPER)
+        if (!nextBacklashISR) nextBacklashISR = backlash_isr(); // 0 = Do backlash take-up pulses
+      #endif
+
       #if ENABLED(BABYSTEPPING)
         const bool is_babystep = (nextBabystepISR == 0);  // 0 = Do Babystepping (XY)Z pulses
         if (is_babystep) nextBabystepISR = babystepping_isr();
@@ -1603,6 +1678,11 @@ void Stepper::isr() {
           NOLESS(nextBabystepISR, nextMainISR / 2);       // TODO: Only look at axes enabled for baby-stepping
       #endif
 
+      #if ENABLED(BACKLASH_IN_STEPPER)
+        if (nextBacklashISR != BACKLASH_NEVER)            // Keep take-up steps clear of axis stepping
+          NOLESS(nextBacklashISR, nextMainISR / 2);
+      #endif
+
       // Get the interval to the next ISR call
       interval = _MIN(nextMainISR, uint32_t(HAL_TIMER_TYPE_MAX));         // Time until the next Pulse / Block phase
       TERN_(INPUT_SHAPING_X, NOMORE(interval, ShapingQueue::peek_x()));   // Time until next input shaping echo for X
@@ -1610,6 +1690,7 @@ void Stepper::isr() {
       TERN_(INPUT_SHAPING_Z, NOMORE(interval, ShapingQueue::peek_z()));   // Time until next input shaping echo for Z
       TERN_(LIN_ADVANCE, NOMORE(interval, nextAdvanceISR));               // Come back early for Linear Advance?
       TERN_(BABYSTEPPING, NOMORE(interval, nextBabystepISR));             // Come back early for Babystepping?
+      TERN_(BACKLASH_IN_STEPPER, NOMORE(interval, nextBacklashISR));      // Come back early for backlash take-up?
 
       //
       // Compute remaining time for each ISR phase
@@ -1622,9 +1703,12 @@ void Stepper::isr() {
       TERN_(HAS_ZV_SHAPING, ShapingQueue::decrement_delays(interval));
       TERN_(LIN_ADVANCE, if (nextAdvanceISR != LA_ADV_NEVER) nextAdvanceISR -= interval);
       TERN_(BABYSTEPPING, if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval);
+      TERN_(BACKLASH_IN_STEPPER, if (nextBacklashISR != BACKLASH_NEVER) nextBacklashISR -= interval);
 
     } // standard motion control
 
+    #endif // !STEP_EVENT_STREAM
+
     /**
      * This needs to avoid a race-condition caused by interleaving
      * of interrupts required by both the LA and Stepper algorithms.
@@ -1692,7 +1776,7 @@ void Stepper::isr() {
       next_isr_ticks = min_ticks;
 
       // When forced out of the ISR, increase multi-stepping
-      #if MULTISTEPPING_LIMIT > 1
+      #if MULTISTEPPING_LIMIT > 1 && DISABLED(STEP_EVENT_STREAM)
         if (steps_per_isr < MULTISTEPPING_LIMIT) {
           steps_per_isr <<= 1;
           // ticks_nominal will need to be recalculated if we are in cruise phase
@@ -1711,6 +1795,8 @@ void Stepper::isr() {
   // Now 'next_isr_ticks' contains the period to the next Stepper ISR - And we are
   // sure that the time has not arrived yet - Warrantied by the scheduler
 
+  TERN_(STEPPER_ISR_PROFILING, isr_profiler.sample_isr(HAL_timer_get_count(MF_TIMER_STEP), next_isr_ticks));
+
   // Set the next ISR to fire at the proper time
   HAL_timer_set_compare(MF_TIMER_STEP, next_isr_ticks);
 
@@ -1724,7 +1810,7 @@ void Stepper::isr() {
 #if MINIMUM_STEPPER_PULSE_NS || MAXIMUM_STEPPER_RATE
   #define ISR_PULSE_CONTROL 1
 #endif
-#if ISR_PULSE_CONTROL && MULTISTEPPING_LIMIT > 1 && DISABLED(I2S_STEPPER_STREAM)
+#if ISR_PULSE_CONTROL && MULTISTEPPING_LIMIT > 1 && NONE(I2S_STEPPER_STREAM, STEP_EVENT_STREAM)
   #define ISR_MULTI_STEPS 1
 #endif
 
@@ -1736,6 +1822,7 @@ void Stepper::isr() {
  * is to keep pulse timing as regular as possible.
  */
 void Stepper::pulse_phase_isr() {
+  PROFILE_ISR_PHASE(PULSE);
 
   // If we must abort the current block, do so!
   if (abort_current_block) {
@@ -1763,6 +1850,9 @@ void Stepper::pulse_phase_isr() {
   // If there is no current block, do nothing
   if (!current_block || step_events_completed >= step_event_count) return;
 
+  // The HAL is making the steps
+  if (TERN0(STEP_PULSE_TRAIN, pulse_train_active)) return;
+
   // Skipping step processing causes motion to freeze
   if (TERN0(FREEZE_FEATURE, frozen)) return;
 
@@ -1773,7 +1863,9 @@ void Stepper::pulse_phase_isr() {
   // Just update the value we will get at the end of the loop
   step_events_completed += events_to_do;
 
-  TERN_(ISR_PULSE_CONTROL, USING_TIMED_PULSE());
+  #if ISR_PULSE_CONTROL && DISABLED(STEP_EVENT_STREAM)
+    USING_TIMED_PULSE();
+  #endif
 
   // Take multiple steps per interrupt. For high speed moves.
   #if ENABLED(ISR_MULTI_STEPS)
@@ -2035,6 +2127,19 @@ void Stepper::pulse_phase_isr() {
       #endif
     }
 
+    #if ENABLED(STEP_EVENT_STREAM)
+
+      // Count the steps and record them for the Stepper ISR to apply later
+      #define _STREAM_STEP(AXIS) do{ \
+        if (step_needed.test(_AXIS(AXIS))) { \
+          count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+          step_event_bits.set(_AXIS(AXIS)); \
+        } \
+      }while(0);
+      LOGICAL_AXIS_MAP(_STREAM_STEP);
+
+    #else // !STEP_EVENT_STREAM
+
     #if ISR_MULTI_STEPS
       if (firstStep)
         firstStep = false;
@@ -2080,6 +2185,10 @@ void Stepper::pulse_phase_isr() {
       PULSE_START(E);
     #endif
 
+    #if ENABLED(ENDSTOP_CAPTURE)
+      if (capture_steps && bool(step_needed)) record_step_time(step_needed);
+    #endif
+
     TERN_(I2S_STEPPER_STREAM, i2s_push_sample());
 
     // TODO: need to deal with MINIMUM_STEPPER_PULSE_NS over i2s
@@ -2127,12 +2236,15 @@ void Stepper::pulse_phase_isr() {
       if (events_to_do) START_TIMED_PULSE();
     #endif
 
+    #endif // !STEP_EVENT_STREAM
+
   } while (--events_to_do);
 }
 
 #if HAS_ZV_SHAPING
 
   void Stepper::shaping_isr() {
+    PROFILE_ISR_PHASE(SHAPING);
     AxisFlags step_needed{0};
 
     // Clear the echoes that are ready to process. If the buffers are too full and risk overflow, also apply echoes early.
@@ -2242,6 +2354,202 @@ hal_timer_t Stepper::calc_timer_interval(uint32_t step_rate) {
   }
 #endif
 
+#if ENABLED(ENDSTOP_CAPTURE)
+
+  void Stepper::record_step_time(const AxisFlags &axes) {
+    step_time_t &s = step_history[step_history_index];
+    s.time = micros();
+    s.axes = axes;
+    if (++step_history_index >= ENDSTOP_CAPTURE_STEPS) step_history_index = 0;
+    if (step_history_count < ENDSTOP_CAPTURE_STEPS) step_history_count++;
+  }
+
+  /**
+   * Count the steps an axis made after an endstop edge, going back through
+   * the step history. Set 'part' to how far the axis had gone into its next
+   * step at the edge. Return 0 if the history doesn't go back to the edge.
+   */
+  uint8_t Stepper::steps_after_edge(const AxisEnum axis, const uint32_t edge, float &part) {
+    part = 0;
+    uint8_t count = 0, i = step_history_index;
+    uint32_t next_time = 0;
+    for (uint8_t n = step_history_count; n--;) {
+      i = (i ? i : ENDSTOP_CAPTURE_STEPS) - 1;
+      const step_time_t &s = step_history[i];
+      if (!s.axes.test(axis)) continue;
+      if (int32_t(s.time - edge) > 0) {   // A step after the edge
+        next_time = s.time;
+        count++;
+        continue;
+      }
+      // The last step before the edge. Interpolate into the next step.
+      if (count) part = float(edge - s.time) / (next_time - s.time);
+      return count;
+    }
+    return 0;
+  }
+
+#endif
+
+#if ENABLED(STEP_PULSE_TRAIN)
+
+  // Axes with one motor on a STEP pin of their own, not stepped on both edges
+  #define PULSE_TRAIN_X (HAS_X_STEP && !HAS_X2_STEPPER && !AXIS_HAS_DEDGE(X))
+  #define PULSE_TRAIN_Y (HAS_Y_STEP && !HAS_Y2_STEPPER && !AXIS_HAS_DEDGE(Y))
+  #define PULSE_TRAIN_Z (HAS_Z_STEP && NUM_Z_STEPPERS == 1 && !AXIS_HAS_DEDGE(Z))
+  #define PULSE_TRAIN_E (E_STEPPERS == 1 && DISABLED(MIXING_EXTRUDER) && !AXIS_HAS_DEDGE(E0))
+
+  /**
+   * Hand the current block to the HAL if it only moves one motor and needs
+   * nothing else from the Stepper ISR for each step. Called at the end of the
+   * block setup, with the directions set and S-curve coefficients ready.
+   * Return true if the HAL is making the steps.
+   */
+  bool Stepper::pulse_train_start() {
+    if (TERN0(DIRECT_STEPPING, current_block->is_page())
+      || TERN0(LIN_ADVANCE, la_active)
+      || TERN0(ENDSTOP_CAPTURE, capture_steps)
+      || TERN0(LASER_RASTER, current_block->laser.raster)
+    ) return false;
+
+    uint8_t moving = 0;
+    AxisEnum axis = X_AXIS;
+    LOOP_LOGICAL_AXES(i) if (current_block->steps[i]) { moving++; axis = AxisEnum(i); }
+    if (moving != 1) return false;
+
+    switch (axis) {
+      #if PULSE_TRAIN_X
+        case X_AXIS:
+          if (TERN0(INPUT_SHAPING_X, shaping_x.enabled)) return false;
+          pulse_train.pin = X_STEP_PIN; pulse_train.active = STEP_STATE_X; break;
+      #endif
+      #if PULSE_TRAIN_Y
+        case Y_AXIS:
+          if (TERN0(INPUT_SHAPING_Y, shaping_y.enabled)) return false;
+          pulse_train.pin = Y_STEP_PIN; pulse_train.active = STEP_STATE_Y; break;
+      #endif
+      #if PULSE_TRAIN_Z
+        case Z_AXIS:
+          if (TERN0(INPUT_SHAPING_Z, shaping_z.enabled)) return false;
+          pulse_train.pin = Z_STEP_PIN; pulse_train.active = STEP_STATE_Z; break;
+      #endif
+      #if PULSE_TRAIN_E
+        case E_AXIS: pulse_train.pin = E0_STEP_PIN; pulse_train.active = STEP_STATE_E; break;
+      #endif
+      default: return false;
+    }
+
+    // Ramps too long for the tables are left to the Stepper ISR
+    const uint32_t steps = current_block->step_event_count,
+                   accel = current_block->accelerate_before,
+                   decel = steps - current_block->decelerate_start;
+    if (accel > STEP_PULSE_TRAIN_RAMP || decel > STEP_PULSE_TRAIN_RAMP) return false;
+
+    // Time the ramps the same way as block_phase_isr
+    uint32_t time = 0, rate = current_block->initial_rate;
+    for (uint16_t n = 0; n < accel; ++n) {
+      #if ENABLED(S_CURVE_ACCELERATION)
+        rate = time < current_block->acceleration_time ? _eval_bezier_curve(time) : current_block->cruise_rate;
+      #else
+        rate = _MIN(STEP_MULTIPLY(time, current_block->acceleration_rate) + current_block->initial_rate, current_block->nominal_rate);
+      #endif
+      time += (pulse_train.accel[n] = calc_timer_interval(rate));
+    }
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
+      bezier_2nd_half = true;
+    #else
+      const uint32_t top_rate = rate;
+    #endif
+    const uint32_t accel_time = time;
+    time = 0;
+    for (uint16_t n = 0; n < decel; ++n) {
+      #if ENABLED(S_CURVE_ACCELERATION)
+        rate = time < current_block->deceleration_time ? _eval_bezier_curve(time) : current_block->final_rate;
+      #else
+        const uint32_t drop = STEP_MULTIPLY(time, current_block->acceleration_rate);
+        rate = drop < top_rate ? _MAX(top_rate - drop, current_block->final_rate) : current_block->final_rate;
+      #endif
+      time += (pulse_train.decel[n] = calc_timer_interval(rate));
+    }
+
+    pulse_train.steps = steps;
+    pulse_train.accel_steps = accel;
+    pulse_train.decel_steps = decel;
+    pulse_train.cruise = calc_timer_interval(current_block->nominal_rate);
+
+    pulse_train_axis = axis;
+    pulse_train_active = true;
+    HAL_pulse_train_start(pulse_train);
+
+    // The time until the last pulse
+    const uint64_t wait = uint64_t(accel_time) + time + uint64_t(steps - accel - decel) * pulse_train.cruise;
+    pulse_train_wait = _MIN(wait, uint64_t(UINT32_MAX));
+    return true;
+  }
+
+  // Part of the time until the last pulse, as long as the Stepper timer can wait
+  hal_timer_t Stepper::pulse_train_next_wait() {
+    const hal_timer_t ticks = _MIN(pulse_train_wait, uint32_t(HAL_TIMER_TYPE_MAX));
+    pulse_train_wait -= ticks;
+    return ticks;
+  }
+
+  // Stop the pulse train, if any, and count the steps it made
+  void Stepper::pulse_train_end() {
+    if (!pulse_train_active) return;
+    const uint32_t made = HAL_pulse_train_stop();
+    pulse_train_active = false;
+    count_position[pulse_train_axis] += int32_t(made) * count_direction[pulse_train_axis];
+    step_events_completed = step_event_count;
+  }
+
+  /**
+   * Stop the pulse train now, for a quick stop or an endstop hit, and fire the
+   * Stepper ISR right away instead of when the last pulse was due.
+   */
+  void Stepper::pulse_train_abort() {
+    const bool was_enabled = suspend();
+    if (pulse_train_active) {
+      pulse_train_end();
+      pulse_train_wait = 0;
+      pulse_train_cut = true;
+      HAL_timer_set_compare(MF_TIMER_STEP, HAL_timer_get_count(MF_TIMER_STEP) + hal_timer_t(TERN(__AVR__, 8, 1) * (STEPPER_TIMER_TICKS_PER_US)));
+    }
+    if (was_enabled) wake_up();
+  }
+
+#endif
+
+#if ENABLED(LASER_RASTER)
+
+  /**
+   * Raster pixels are spread evenly over the step events of the block.
+   * Each pixel scales the block power (S) from 0 to 255.
+   */
+  void Stepper::raster_apply() {
+    const uint8_t px = laser_raster.pixels(current_block->laser.raster - 1)[raster_pixel];
+    cutter.apply_power((px * (current_block->laser.power + 1)) >> 8);
+  }
+
+  void Stepper::raster_start() {
+    raster_pixel = 0;
+    raster_next_step = step_event_count / laser_raster.pixel_count(current_block->laser.raster - 1);
+    raster_apply();
+  }
+
+  void Stepper::raster_update() {
+    if (step_events_completed < raster_next_step) return;
+    // The last pixel runs to the end of the block, so there's always one more here
+    const uint16_t count = laser_raster.pixel_count(current_block->laser.raster - 1);
+    do raster_next_step = uint32_t(++raster_pixel + 1) * step_event_count / count;
+    while (raster_next_step <= step_events_completed);
+    raster_apply();
+  }
+
+#endif
+
 // Get the timer interval and the number of loops to perform per tick
 hal_timer_t Stepper::calc_multistep_timer_interval(uint32_t step_rate) {
 
@@ -2390,6 +2698,7 @@ void Stepper::set_axis_moved_for_current_block() {
  * have been done, so it is less time critical.
  */
 hal_timer_t Stepper::block_phase_isr() {
+  PROFILE_ISR_PHASE(BLOCK);
   #if DISABLED(OLD_ADAPTIVE_MULTISTEPPING)
     // If the ISR uses < 50% of MPU time, halve multi-stepping
     const hal_timer_t time_spent = HAL_timer_get_count(MF_TIMER_STEP);
@@ -2409,6 +2718,15 @@ hal_timer_t Stepper::block_phase_isr() {
 
   // If there is a current block
   if (current_block) {
+    #if ENABLED(STEP_PULSE_TRAIN)
+      // Wait for the last pulse. If it's a little late, check again after one more period.
+      if (pulse_train_active) {
+        if (HAL_pulse_train_busy())
+          return pulse_train_wait ? pulse_train_next_wait() : pulse_train.period(pulse_train.steps - 1);
+        pulse_train_end();
+      }
+    #endif
+
     // If current block is finished, reset pointer and finalize state
     if (step_events_completed >= step_event_count) {
       #if ENABLED(DIRECT_STEPPING)
@@ -2429,6 +2747,8 @@ hal_timer_t Stepper::block_phase_isr() {
         }
       #endif
       TERN_(HAS_FILAMENT_RUNOUT_DISTANCE, runout.block_completed(current_block));
+      TERN_(FILWIDTH_FLOW_COMPENSATION, flowcomp.block_completed(current_block));
+      TERN_(LASER_RASTER, if (current_block->laser.raster) cutter.apply_power(0));
       discard_current_block();
     }
     else {
@@ -2600,6 +2920,9 @@ hal_timer_t Stepper::block_phase_isr() {
         // The timer interval is just the nominal value for the nominal speed
         interval = ticks_nominal;
       }
+
+      // Move on to the raster pixel under the current step
+      TERN_(LASER_RASTER, if (current_block->laser.raster) raster_update());
     }
 
     #if ENABLED(LASER_FEATURE)
@@ -2651,6 +2974,9 @@ hal_timer_t Stepper::block_phase_isr() {
           if (current_block->is_sync_fan()) planner.sync_fan_speeds(current_block->fan_speed);
         #endif
 
+        // Reset the runout sensor for a tool-change E move
+        TERN_(HAS_SYNC_RUNOUT, if (current_block->is_sync_runout()) runout.reset());
+
         // Set position
         if (current_block->is_sync_pos()) _set_position(current_block->position);
 
@@ -2753,6 +3079,12 @@ hal_timer_t Stepper::block_phase_isr() {
       // No step events completed so far
       step_events_completed = 0;
 
+      #if ENABLED(ENDSTOP_CAPTURE)
+        // Start a new step history for a homing or probing move
+        step_history_count = 0;
+        capture_steps = endstops.capture_enabled();
+      #endif
+
       // Compute the acceleration and deceleration points
       accelerate_before = current_block->accelerate_before << oversampling_factor;
       decelerate_start = current_block->decelerate_start << oversampling_factor;
@@ -2782,6 +3114,17 @@ hal_timer_t Stepper::block_phase_isr() {
         set_directions(current_block->direction_bits);
       }
 
+      #if ENABLED(BACKLASH_IN_STEPPER)
+        // Axes moving in a new direction start taking up their backlash
+        bool backlash_pending = false;
+        LOOP_NUM_AXES(a) {
+          if (current_block->steps[a])
+            backlash_target[a] = current_block->direction_bits[a] ? backlash.takeup_steps[a] : 0;
+          if (backlash_applied[a] != backlash_target[a]) backlash_pending = true;
+        }
+        if (backlash_pending && nextBacklashISR == BACKLASH_NEVER) nextBacklashISR = 0;
+      #endif
+
       #if ENABLED(LASER_FEATURE)
         if (cutter.cutter_mode == CUTTER_MODE_CONTINUOUS) {           // Planner controls the laser
           if (planner.laser_inline.status.isSyncPower)
@@ -2796,13 +3139,15 @@ hal_timer_t Stepper::block_phase_isr() {
               cutter.apply_power(current_block->laser.status.isPowered ? current_block->laser.power : 0);
             #endif
           }
+          TERN_(LASER_RASTER, if (current_block->laser.raster) raster_start());
         }
       #endif // LASER_FEATURE
 
       // If the endstop is already pressed, endstop interrupts won't invoke
       // endstop_triggered and the move will grind. So check here for a
       // triggered endstop, which marks the block for discard on the next ISR.
-      endstops.update();
+      // A step event stream checks when the Stepper ISR gets to the block.
+      IF_DISABLED(STEP_EVENT_STREAM, endstops.update());
 
       #if ENABLED(Z_LATE_ENABLE)
         // If delayed Z enable, enable it now. This option will severely interfere with
@@ -2854,6 +3199,11 @@ hal_timer_t Stepper::block_phase_isr() {
           la_interval = calc_timer_interval((current_block->initial_rate + la_step_rate) >> current_block->la_scaling);
         }
       #endif
+
+      #if ENABLED(STEP_PULSE_TRAIN)
+        // Hand a single-motor move to the HAL, and come back when its last pulse is due
+        if (!abort_current_block && pulse_train_start()) interval = pulse_train_next_wait();
+      #endif
     }
   } // !current_block
 
@@ -2865,6 +3215,7 @@ hal_timer_t Stepper::block_phase_isr() {
 
   // Timer interrupt for E. LA_steps is set in the main routine
   void Stepper::advance_isr() {
+    PROFILE_ISR_PHASE(ADVANCE);
     // Apply Bresenham algorithm so that linear advance can piggy back on
     // the acceleration and speed values calculated in block_phase_isr().
     // This helps keep LA in sync with, for example, S_CURVE_ACCELERATION.
@@ -2896,10 +3247,50 @@ hal_timer_t Stepper::block_phase_isr() {
 
 #endif // LIN_ADVANCE
 
+#if ENABLED(BACKLASH_IN_STEPPER)
+
+  /**
+   * Make one take-up step on each axis short of its target, at the rate
+   * of the slowest of them. An axis only steps while its DIR is set the
+   * way it needs to go, so an axis left idle by the current block waits
+   * for a block that moves it.
+   */
+  hal_timer_t Stepper::backlash_isr() {
+    AxisBits step_axes;
+    hal_timer_t interval = 0;
+    LOOP_NUM_AXES(a) {
+      const int32_t diff = backlash_target[a] - backlash_applied[a];
+      if (diff && (diff > 0) == last_direction_bits[a]) {
+        step_axes.bset(AxisEnum(a));
+        backlash_applied[a] += diff > 0 ? 1 : -1;
+        NOLESS(interval, backlash.takeup_ticks[a]);
+      }
+    }
+    if (!step_axes) return BACKLASH_NEVER;
+
+    USING_TIMED_PULSE();
+
+    #define _BACKLASH_STEP_START(A) if (step_axes[_AXIS(A)]) A##_APPLY_STEP(STEP_STATE_##A, false);
+    MAIN_AXIS_MAP(_BACKLASH_STEP_START);
+
+    START_TIMED_PULSE();
+    AWAIT_HIGH_PULSE();
+
+    #define _BACKLASH_STEP_STOP(A) if (step_axes[_AXIS(A)]) A##_APPLY_STEP(!STEP_STATE_##A, false);
+    MAIN_AXIS_MAP(_BACKLASH_STEP_STOP);
+
+    return interval;
+  }
+
+#endif
+
 #if ENABLED(BABYSTEPPING)
 
   // Timer interrupt for baby-stepping
   hal_timer_t Stepper::babystepping_isr() {
+    PROFILE_ISR_PHASE(BABYSTEP);
+    // Wait for the pulse train, which may be using the same stepper
+    if (TERN0(STEP_PULSE_TRAIN, pulse_train_active)) return BABYSTEP_TICKS;
     babystep.task();
     return babystep.has_steps() ? BABYSTEP_TICKS : BABYSTEP_NEVER;
   }
@@ -2909,7 +3300,122 @@ hal_timer_t Stepper::block_phase_isr() {
 // Check if the given block is busy or not - Must not be called from ISR contexts
 // The current_block could change in the middle of the read by an Stepper ISR, so
 // we must explicitly prevent that!
+#if ENABLED(STEP_EVENT_STREAM)
+
+  // Generate events up to this far ahead, well beyond the interval between calls
+  constexpr uint32_t step_stream_horizon = 4UL * (STEPPER_TIMER_RATE) / (TEMP_TIMER_FREQUENCY);
+
+  /**
+   * Run the pulse and block phases ahead of time, outside of the Stepper ISR,
+   * recording each step event with its timing instead of applying it.
+   * This is called at ~1kHz from the Temperature ISR, which the Stepper ISR can preempt.
+   * Only this function writes to the head of the buffer.
+   */
+  void Stepper::step_stream_task() {
+    // This reads and releases planner blocks, so suspend() must hold it off along with the Stepper ISR
+    if (!is_awake()) return;
+
+    for (;;) {
+      const uint16_t next = (step_event_head + 1) & (STEP_EVENT_BUFFER_SIZE - 1);
+      if (next == step_event_tail) break;                                 // Buffer full
+      if (step_ticks_queued - step_ticks_done >= step_stream_horizon) break; // Far enough ahead
+
+      step_event_bits.reset();
+      pulse_phase_isr();                              // Bresenham for the next step event
+      const AxisBits dir = last_direction_bits,       // Directions for the steps just taken
+                     moving = axis_did_move;          // Axes moving in the block of these steps
+      const hal_timer_t interval = block_phase_isr(); // Time to the next step event, and get the next block
+
+      if (!step_event_bits && !current_block) break;  // Nothing to do
+
+      step_event_t &event = step_events[step_event_head];
+      event.interval = interval;
+      event.step = step_event_bits;
+      event.dir = dir;
+      event.moving = moving;
+      step_ticks_queued += interval;
+      step_event_head = next;
+    }
+  }
+
+  /**
+   * Apply the next step event to the pins. Return the interval to the next event.
+   * Only this function writes to the tail of the buffer.
+   */
+  hal_timer_t Stepper::step_stream_isr() {
+    // No events? Nothing is moving. Check back in 1ms.
+    if (!step_stream_busy()) {
+      stream_did_move.reset();
+      return (STEPPER_TIMER_RATE) / 1000UL;
+    }
+
+    const step_event_t &event = step_events[step_event_tail];
+
+    if (event.dir != stream_set_direction) {
+      DIR_WAIT_BEFORE();
+      #define _STREAM_APPLY_DIR(A) if (event.dir[_AXIS(A)] != stream_set_direction[_AXIS(A)]) A##_APPLY_DIR(event.dir[_AXIS(A)], false);
+      LOGICAL_AXIS_MAP(_STREAM_APPLY_DIR);
+      stream_set_direction = event.dir;
+      DIR_WAIT_AFTER();
+    }
+
+    // Reaching a block with new motion, check for an endstop that's already pressed
+    if (event.moving != stream_did_move) {
+      stream_did_move = event.moving;
+      endstops.update();
+      if (!step_stream_busy()) return (STEPPER_TIMER_RATE) / 1000UL; // Flushed by endstop_triggered
+    }
+
+    if (event.step) {
+      USING_TIMED_PULSE();
+
+      #define _STREAM_STEP_START(A) if (event.step[_AXIS(A)]) A##_APPLY_STEP(STEP_STATE_##A, false);
+      LOGICAL_AXIS_MAP(_STREAM_STEP_START);
+
+      START_TIMED_PULSE();
+      AWAIT_HIGH_PULSE();
+
+      #define _STREAM_STEP_STOP(A) if (event.step[_AXIS(A)]) A##_APPLY_STEP(!STEP_STATE_##A, false);
+      LOGICAL_AXIS_MAP(_STREAM_STEP_STOP);
+    }
+
+    const hal_timer_t interval = event.interval;
+    step_ticks_done += interval;
+    step_event_tail = (step_event_tail + 1) & (STEP_EVENT_BUFFER_SIZE - 1);
+    return interval;
+  }
+
+  /**
+   * Drop the events that haven't been applied and take back
+   * their steps so count_position matches the real position.
+   */
+  void Stepper::step_stream_flush() {
+    const bool was_on = hal.isr_state();
+    hal.isr_off();
+
+    for (uint16_t i = step_event_tail; i != step_event_head; i = (i + 1) & (STEP_EVENT_BUFFER_SIZE - 1)) {
+      const step_event_t &event = step_events[i];
+      #define _STREAM_UNSTEP(A) if (event.step[_AXIS(A)]) count_position[_AXIS(A)] -= event.dir[_AXIS(A)] ? 1 : -1;
+      LOGICAL_AXIS_MAP(_STREAM_UNSTEP);
+    }
+    step_event_tail = step_event_head;
+    step_ticks_done = step_ticks_queued;
+    stream_did_move.reset();
+
+    if (was_on) hal.isr_on();
+  }
+
+#endif // STEP_EVENT_STREAM
+
 bool Stepper::is_block_busy(const block_t * const block) {
+  #if ENABLED(MOTION_CORE)
+    // The Stepper ISR runs on the other core, so a block is busy as soon as
+    // get_current_block() has claimed it, even before it's the current_block.
+    lf_full_fence();
+    if (block == &planner.block_buffer[planner.block_buffer_tail] && planner.block_buffer_nonbusy != planner.block_buffer_tail)
+      return true;
+  #endif
+
   #ifdef __AVR__
     // A SW memory barrier, to ensure GCC does not overoptimize loops
     #define sw_barrier() asm volatile("": : :"memory");
@@ -3445,22 +3951,45 @@ void Stepper::endstop_triggered(const AxisEnum axis) {
 
   ATOMIC_SECTION_START();   // Suspend the Stepper ISR on all platforms
 
+  // Take back the steps that were generated but not yet made
+  TERN_(STEP_EVENT_STREAM, step_stream_flush());
+
+  // Stop the pulse train, count the steps it made, and have the Stepper ISR finish the block now
+  TERN_(STEP_PULSE_TRAIN, pulse_train_abort());
+
+  xyze_long_t pos = count_position;
+
+  #if ENABLED(ENDSTOP_CAPTURE)
+    // Go back to where the motors were at the endstop edge
+    xyze_float_t part{0};
+    LOOP_NUM_AXES(i) {
+      const uint8_t steps = steps_after_edge(AxisEnum(i), endstops.edge_time, part[i]);
+      pos[i] -= steps * count_direction[i];
+      part[i] *= count_direction[i];
+    }
+    // A part step only makes sense for an axis with its own motor
+    #if IS_CORE || ANY(MARKFORGED_XY, MARKFORGED_YX)
+      if (axis == CORE_AXIS_1 || axis == CORE_AXIS_2) part[axis] = 0;
+    #endif
+    endstops_trigpart[axis] = part[axis];
+  #endif
+
   endstops_trigsteps[axis] = (
     #if IS_CORE
       (axis == CORE_AXIS_2
-        ? CORESIGN(count_position[CORE_AXIS_1] - count_position[CORE_AXIS_2])
-        : count_position[CORE_AXIS_1] + count_position[CORE_AXIS_2]
+        ? CORESIGN(pos[CORE_AXIS_1] - pos[CORE_AXIS_2])
+        : pos[CORE_AXIS_1] + pos[CORE_AXIS_2]
       ) * double(0.5)
     #elif ENABLED(MARKFORGED_XY)
       axis == CORE_AXIS_1
-        ? count_position[CORE_AXIS_1] TERN(MARKFORGED_INVERSE, +, -) count_position[CORE_AXIS_2]
-        : count_position[CORE_AXIS_2]
+        ? pos[CORE_AXIS_1] TERN(MARKFORGED_INVERSE, +, -) pos[CORE_AXIS_2]
+        : pos[CORE_AXIS_2]
     #elif ENABLED(MARKFORGED_YX)
       axis == CORE_AXIS_1
-        ? count_position[CORE_AXIS_1]
-        : count_position[CORE_AXIS_2] TERN(MARKFORGED_INVERSE, +, -) count_position[CORE_AXIS_1]
+        ? pos[CORE_AXIS_1]
+        : pos[CORE_AXIS_2] TERN(MARKFORGED_INVERSE, +, -) pos[CORE_AXIS_1]
     #else // !IS_CORE
-      count_position[axis]
+      pos[axis]
     #endif
   );
 
@@ -55,6 +55,14 @@
   #include "ft_types.h"
 #endif
 
+#if ENABLED(LASER_RASTER)
+  #include "../feature/laser_raster.h"
+#endif
+
+#if ENABLED(STEP_PULSE_TRAIN)
+  #include "stepper/pulse_train.h"
+#endif
+
 // TODO: Review and ensure proper handling for special E axes with commands like M17/M18, stepper timeout, etc.
 #if ENABLED(MIXING_EXTRUDER)
   #define E_STATES EXTRUDERS  // All steppers are set together for each mixer. (Currently limited to 1.)
@@ -286,6 +294,15 @@ constexpr ena_mask_t enable_overlap[] = {
   typedef struct { int32_t A, B, C; } ne_fix_t;
 #endif
 
+#if ENABLED(STEP_EVENT_STREAM)
+  // A step event generated ahead of time for the Stepper ISR to apply
+  typedef struct {
+    hal_timer_t interval;   // Ticks from this event to the next
+    AxisBits step, dir,     // Axes to step, and the direction of every axis
+             moving;        // Axes moving in the block, for the endstops
+  } step_event_t;
+#endif
+
 //
 // Stepper class definition
 //
@@ -348,6 +365,12 @@ class Stepper {
       static constexpr bool adaptive_step_smoothing_enabled = true;
     #endif
 
+    #if ALL(S_CURVE_ACCELERATION, UNIT_TEST)
+      // Out-of-line calls to the inline speed curve for the host tests
+      static void test_bezier_coeffs(const int32_t v0, const int32_t v1, const uint32_t av);
+      static int32_t test_bezier_eval(const uint32_t curr_step);
+    #endif
+
   private:
 
     static block_t* current_block;        // A pointer to the block currently being traced
@@ -452,10 +475,30 @@ class Stepper {
       static hal_timer_t nextBabystepISR;
     #endif
 
+    #if ENABLED(BACKLASH_IN_STEPPER)
+      static constexpr hal_timer_t BACKLASH_NEVER = HAL_TIMER_TYPE_MAX;
+      static hal_timer_t nextBacklashISR;
+      static xyz_long_t backlash_applied,   // Take-up steps made on each axis
+                        backlash_target;    // Take-up steps wanted for the last direction of travel
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static page_step_state_t page_step_state;
     #endif
 
+    #if ENABLED(STEP_PULSE_TRAIN)
+      static PulseTrain pulse_train;                // The HAL makes the steps of the current block
+      static AxisEnum pulse_train_axis;
+      static volatile bool pulse_train_active,
+                           pulse_train_cut;         // Stopped early, so run the block phase on the next ISR
+      static uint32_t pulse_train_wait;             // Ticks left until the last pulse
+    #endif
+
+    #if ENABLED(LASER_RASTER)
+      static uint16_t raster_pixel;         // The raster pixel being lasered
+      static uint32_t raster_next_step;     // The step event where the next pixel starts
+    #endif
+
     static hal_timer_t ticks_nominal;
     #if DISABLED(S_CURVE_ACCELERATION)
       static uint32_t acc_step_rate; // needed for deceleration start point
@@ -464,12 +507,28 @@ class Stepper {
     // Exact steps at which an endstop was triggered
     static xyz_long_t endstops_trigsteps;
 
+    #if ENABLED(ENDSTOP_CAPTURE)
+      static bool capture_steps;          // Homing or probing, so record step times
+      static xyz_float_t endstops_trigpart; // Part of a step past the triggered position
+    #endif
+
     // Positions of stepper motors, in step units
     static xyze_long_t count_position;
 
     // Current stepper motor directions (+1 or -1)
     static xyze_int8_t count_direction;
 
+    #if ENABLED(STEP_EVENT_STREAM)
+      static step_event_t step_events[STEP_EVENT_BUFFER_SIZE]; // Step events waiting for the Stepper ISR
+      static volatile uint16_t step_event_head,   // Next slot to fill by the step generator
+                               step_event_tail;   // Next event to apply by the Stepper ISR
+      static volatile uint32_t step_ticks_queued, // Total ticks of the events generated so far
+                               step_ticks_done;   // Total ticks of the events applied so far
+      static AxisBits step_event_bits;            // Steps recorded by pulse_phase_isr for the next event
+      static AxisBits stream_set_direction,       // The DIR bits last applied to the pins by the Stepper ISR
+                      stream_did_move;            // The moving axes of the last step event applied
+    #endif
+
   public:
     // Initialize stepper hardware
     static void init();
@@ -482,6 +541,7 @@ class Stepper {
 
     static bool is_awake() { return STEPPER_ISR_ENABLED(); }
 
+    // Hold off the Stepper ISR (and with STEP_EVENT_STREAM the step generator) to change planner or stepper state
     static bool suspend() {
       const bool awake = is_awake();
       if (awake) DISABLE_STEPPER_DRIVER_INTERRUPT();
@@ -506,6 +566,22 @@ class Stepper {
       static void advance_isr();
     #endif
 
+    #if ENABLED(STEP_EVENT_STREAM)
+      // Generate step events ahead of the Stepper ISR, outside of it
+      static void step_stream_task();
+      // Apply the next step event. Return the interval to the next one.
+      static hal_timer_t step_stream_isr();
+      // Drop the step events not applied yet and take back their steps
+      static void step_stream_flush();
+      // Check whether any step events are waiting
+      static bool step_stream_busy() { return step_event_head != step_event_tail; }
+    #endif
+
+    #if ENABLED(BACKLASH_IN_STEPPER)
+      // The backlash take-up ISR phase
+      static hal_timer_t backlash_isr();
+    #endif
+
     #if ENABLED(BABYSTEPPING)
       // The Babystepping ISR phase
       static hal_timer_t babystepping_isr();
@@ -555,6 +631,8 @@ class Stepper {
       #if ENABLED(DIRECT_STEPPING)
         if (current_block->is_page()) page_manager.free_page(current_block->page_idx);
       #endif
+      TERN_(LASER_RASTER, if (current_block->laser.raster) laser_raster.release(current_block->laser.raster - 1));
+      TERN_(STEP_PULSE_TRAIN, pulse_train_end());
       current_block = nullptr;
       axis_did_move.reset();
       planner.release_current_block();
@@ -562,13 +640,18 @@ class Stepper {
     }
 
     // Quickly stop all steppers
-    FORCE_INLINE static void quick_stop() { abort_current_block = true; }
+    FORCE_INLINE static void quick_stop() {
+      abort_current_block = true;
+      TERN_(STEP_EVENT_STREAM, step_stream_flush());
+      TERN_(STEP_PULSE_TRAIN, pulse_train_abort());
+    }
 
     // The direction of a single motor. A true result indicates forward or positive motion.
-    FORCE_INLINE static bool motor_direction(const AxisEnum axis) { return last_direction_bits[axis]; }
+    // With STEP_EVENT_STREAM this is the direction of the steps applied, not the ones generated ahead.
+    FORCE_INLINE static bool motor_direction(const AxisEnum axis) { return TERN(STEP_EVENT_STREAM, stream_set_direction, last_direction_bits)[axis]; }
 
     // The last movement direction was not null on the specified axis. Note that motor direction is not necessarily the same.
-    FORCE_INLINE static bool axis_is_moving(const AxisEnum axis) { return axis_did_move[axis]; }
+    FORCE_INLINE static bool axis_is_moving(const AxisEnum axis) { return TERN(STEP_EVENT_STREAM, stream_did_move, axis_did_move)[axis]; }
 
     // Handle a triggered endstop
     static void endstop_triggered(const AxisEnum axis);
@@ -576,6 +659,19 @@ class Stepper {
     // Triggered position of an axis in steps
     static int32_t triggered_position(const AxisEnum axis);
 
+    #if ENABLED(ENDSTOP_CAPTURE)
+      // Part of a step past the triggered position, from -1 to 1
+      static float triggered_part(const AxisEnum axis) { return endstops_trigpart[axis]; }
+
+      // Step times for the current block, to find the axes at an endstop edge
+      typedef struct { uint32_t time; AxisFlags axes; } step_time_t;
+      static step_time_t step_history[ENDSTOP_CAPTURE_STEPS];
+      static uint8_t step_history_index,  // Next entry to fill
+                     step_history_count;  // Entries filled since the block started
+
+      static uint8_t steps_after_edge(const AxisEnum axis, const uint32_t edge, float &part);
+    #endif
+
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
       static void set_digipot_value_spi(const int16_t address, const int16_t value);
       static void set_digipot_current(const uint8_t driver, const int16_t current);
@@ -679,7 +775,14 @@ class Stepper {
     // Set direction bits and update all stepper DIR states
     static void set_directions(const AxisBits bits) {
       last_direction_bits = bits;
-      apply_directions();
+      #if ENABLED(STEP_EVENT_STREAM)
+        // The Stepper ISR sets the DIR pins along with each step event
+        #define _SET_COUNT_DIR(A) count_direction[_AXIS(A)] = bits[_AXIS(A)] ? 1 : -1;
+        LOGICAL_AXIS_MAP(_SET_COUNT_DIR);
+        #undef _SET_COUNT_DIR
+      #else
+        apply_directions();
+      #endif
     }
 
     #if ENABLED(FT_MOTION)
@@ -712,6 +815,23 @@ class Stepper {
       static void calc_nonlinear_e(uint32_t step_rate);
     #endif
 
+    #if ENABLED(ENDSTOP_CAPTURE)
+      static void record_step_time(const AxisFlags &axes);
+    #endif
+
+    #if ENABLED(STEP_PULSE_TRAIN)
+      static bool pulse_train_start();
+      static hal_timer_t pulse_train_next_wait();
+      static void pulse_train_end();
+      static void pulse_train_abort();
+    #endif
+
+    #if ENABLED(LASER_RASTER)
+      static void raster_start();
+      static void raster_update();
+      static void raster_apply();
+    #endif
+
     #if ENABLED(S_CURVE_ACCELERATION)
       static void _calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av);
       static int32_t _eval_bezier_curve(const uint32_t curr_step);
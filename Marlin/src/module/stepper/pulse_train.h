@@ -0,0 +1,58 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * pulse_train.h - Step pulses made by a HAL timer
+ *
+ * A HAL with a timer that can drive a STEP pin by itself (e.g., PWM or
+ * one-pulse mode with the period reloaded by DMA) defines HAL_PULSE_TRAIN
+ * and provides the functions below.
+ *
+ * The Stepper fills in the train when a single-motor block starts, with the
+ * periods of the ramps worked out ahead. The HAL only has to look them up.
+ * The train doesn't change until the HAL is done with it or stopped.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+struct PulseTrain {
+  pin_t pin;                  // The STEP pin
+  bool active;                // The STEP pin state for a pulse
+  uint32_t steps;             // Pulses to make
+  uint16_t accel_steps,       // Pulses timed by the accel table
+           decel_steps;       // Pulses timed by the decel table
+  hal_timer_t cruise;         // Period for the pulses between the ramps
+  hal_timer_t accel[STEP_PULSE_TRAIN_RAMP],
+              decel[STEP_PULSE_TRAIN_RAMP];
+
+  // Stepper timer ticks to wait before pulse n
+  hal_timer_t period(const uint32_t n) const {
+    if (n < accel_steps) return accel[n];
+    const uint32_t left = steps - n;
+    return left <= decel_steps ? decel[decel_steps - left] : cruise;
+  }
+};
+
+void HAL_pulse_train_start(const PulseTrain &train); // Start making pulses
+bool HAL_pulse_train_busy();                         // Pulses still to come?
+uint32_t HAL_pulse_train_stop();                     // Stop at once. Return the number of pulses made.
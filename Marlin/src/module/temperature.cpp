@@ -204,7 +204,7 @@
   #include "probe.h"
 #endif
 
-#if ANY(MPCTEMP, PID_EXTRUSION_SCALING)
+#if ANY(MPCTEMP, PID_EXTRUSION_SCALING, STEP_EVENT_STREAM)
   #include "stepper.h"
 #endif
 
@@ -212,6 +212,10 @@
   #include "../feature/filwidth.h"
 #endif
 
+#if ENABLED(FILWIDTH_FLOW_COMPENSATION)
+  #include "../feature/flowcomp.h"
+#endif
+
 #if HAS_POWER_MONITOR
   #include "../feature/power_monitor.h"
 #endif
@@ -2343,8 +2347,11 @@ void Temperature::task() {
   /**
    * Dynamically set the volumetric multiplier based
    * on the delayed Filament Width measurement.
+   * Flow compensation corrects each block instead.
    */
-  TERN_(FILAMENT_WIDTH_SENSOR, filwidth.update_volumetric());
+  #if ENABLED(FILAMENT_WIDTH_SENSOR) && DISABLED(FILWIDTH_FLOW_COMPENSATION)
+    filwidth.update_volumetric();
+  #endif
 
   // Handle Bed Temp Errors, Heating Watch, etc.
   TERN_(HAS_HEATED_BED, manage_heated_bed(ms));
@@ -2828,6 +2835,7 @@ void Temperature::updateTemperaturesFromRawValues() {
   TERN_(HAS_TEMP_REDUNDANT, temp_redundant.celsius = analog_to_celsius_redundant(temp_redundant.getraw()));
 
   TERN_(FILAMENT_WIDTH_SENSOR, filwidth.update_measured_mm());
+  TERN_(FILWIDTH_FLOW_COMPENSATION, flowcomp.update());
   TERN_(HAS_POWER_MONITOR,     power_monitor.capture_values());
 
   #if HAS_HOTEND
@@ -3964,9 +3972,13 @@ public:
  *  - Advance Babysteps
  *  - Endstop polling
  *  - Planner clean buffer
+ *  - Generate step events ahead of the Stepper ISR
  */
 void Temperature::isr() {
 
+  // Keep the Stepper ISR supplied with step events
+  TERN_(STEP_EVENT_STREAM, stepper.step_stream_task());
+
   // Shut down the laser if steppers are inactive for > LASER_SAFETY_TIMEOUT_MS ms
   #if LASER_SAFETY_TIMEOUT_MS > 0
     if (cutter.last_power_applied && ELAPSED(millis(), gcode.previous_move_ms + (LASER_SAFETY_TIMEOUT_MS))) {
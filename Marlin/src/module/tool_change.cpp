@@ -155,6 +155,23 @@ void _line_to_current(const AxisEnum fr_axis, const float fscale=1) {
 void slow_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.2f); }
 void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.5f); }
 
+// Wait for tool-change moves to finish, unless they are left in the planner
+inline void toolchange_sync() { IF_DISABLED(TOOLCHANGE_QUEUED_MOVES, planner.synchronize()); }
+
+/**
+ * Move to XY and Z, raising Z before XY or lowering it after.
+ * With TOOLCHANGE_QUEUED_MOVES the moves are queued without waiting.
+ */
+void toolchange_move_to_xy_z(const xy_pos_t &raw, const_float_t z, const_feedRate_t fr_mm_s) {
+  #if ENABLED(TOOLCHANGE_QUEUED_MOVES) && !IS_KINEMATIC
+    if (current_position.z < z) { current_position.z = z; line_to_current_position(fr_mm_s); }
+    current_position.set(raw.x, raw.y); line_to_current_position(fr_mm_s);
+    if (current_position.z > z) { current_position.z = z; line_to_current_position(fr_mm_s); }
+  #else
+    do_blocking_move_to_xy_z(raw, z, fr_mm_s);
+  #endif
+}
+
 #define DEBUG_OUT ENABLED(DEBUG_TOOL_CHANGE)
 #include "../core/debug_out.h"
 
@@ -376,6 +393,7 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
       parking_extruder_set_parked(false);
     }
     else if (do_solenoid_activation) {
+      TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize());
       // Deactivate current extruder solenoid
       pe_solenoid_set_pin_state(active_extruder, !PARKING_EXTRUDER_SOLENOIDS_PINS_ACTIVE);
       // Engage new extruder magnetic field
@@ -859,8 +877,8 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
       DEBUG_ECHOLNPGM("MoveX to ", xhome);
       current_position.x = xhome;
       line_to_current_position(planner.settings.max_feedrate_mm_s[X_AXIS]);   // Park the current head
-      planner.synchronize();
     }
+    planner.synchronize(); // Stop before switching carriages
 
     // Activate the new extruder ahead of calling set_axis_is_at_home!
     active_extruder = new_tool;
@@ -909,9 +927,21 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
     bool enable_first_prime; // As set by M217 V
   #endif
 
+  // Queue an E move, waiting for it only without TOOLCHANGE_QUEUED_MOVES
+  void toolchange_e_move(const_float_t length, const_feedRate_t fr_mm_s) {
+    #if ENABLED(TOOLCHANGE_QUEUED_MOVES)
+      TERN_(HAS_SYNC_RUNOUT, planner.buffer_sync_block(BLOCK_BIT_SYNC_RUNOUT)); // Reset the sensor when the move starts
+      current_position.e += length / planner.e_factor[active_extruder];
+      line_to_current_position(fr_mm_s);
+    #else
+      unscaled_e_move(length, fr_mm_s);
+    #endif
+  }
+
   // Cool down with fan
   inline void filament_swap_cooling() {
     #if HAS_FAN && TOOLCHANGE_FS_FAN >= 0
+      planner.synchronize(); // Cool for the full time after the prime
       thermalManager.fan_speed[TOOLCHANGE_FS_FAN] = toolchange_settings.fan_speed;
       gcode.dwell(SEC_TO_MS(toolchange_settings.fan_time));
       thermalManager.fan_speed[TOOLCHANGE_FS_FAN] = FAN_OFF_PWM;
@@ -944,7 +974,7 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
     if (too_cold(active_extruder)) return;
     const float dist = toolchange_settings.extra_resume + toolchange_settings.wipe_retract;
     DEBUG_ECHOLNPGM("Performing Cutting Recover | Distance: ", dist, " | Speed: ", MMM_TO_MMS(toolchange_settings.unretract_speed), "mm/s");
-    unscaled_e_move(dist, MMM_TO_MMS(toolchange_settings.unretract_speed));
+    toolchange_e_move(dist, MMM_TO_MMS(toolchange_settings.unretract_speed));
 
     DEBUG_ECHOLNPGM("Set E position: ", e);
     current_position.e = e;
@@ -980,7 +1010,7 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
         const feedRate_t prime_mm_s = MMM_TO_MMS(toolchange_settings.prime_speed);
         DEBUG_ECHOLNPGM("First time priming T", active_extruder, ", reducing speed from ", fr_mm_s, " to ",  prime_mm_s, "mm/s");
         fr_mm_s = prime_mm_s;
-        unscaled_e_move(0, fr_mm_s);      // Init planner with 0 length move
+        toolchange_e_move(0, fr_mm_s);    // Init planner with 0 length move
       }
     #endif
 
@@ -989,11 +1019,11 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
       // Positive extra_prime value
       // - Return filament at speed (fr_mm_s) then extra_prime at prime speed
       DEBUG_ECHOLNPGM("Loading Filament for T", active_extruder, " | Distance: ", toolchange_settings.swap_length, " | Speed: ", fr_mm_s, "mm/s");
-      unscaled_e_move(toolchange_settings.swap_length, fr_mm_s); // Prime (Unretract) filament by extruding equal to Swap Length (Unretract)
+      toolchange_e_move(toolchange_settings.swap_length, fr_mm_s); // Prime (Unretract) filament by extruding equal to Swap Length (Unretract)
 
       if (toolchange_settings.extra_prime > 0) {
         DEBUG_ECHOLNPGM("Performing Extra Priming for T", active_extruder, " | Distance: ", toolchange_settings.extra_prime, " | Speed: ", MMM_TO_MMS(toolchange_settings.prime_speed), "mm/s");
-        unscaled_e_move(toolchange_settings.extra_prime, MMM_TO_MMS(toolchange_settings.prime_speed)); // Extra Prime Distance
+        toolchange_e_move(toolchange_settings.extra_prime, MMM_TO_MMS(toolchange_settings.prime_speed)); // Extra Prime Distance
       }
     }
     else {
@@ -1002,7 +1032,7 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
       const float eswap = toolchange_settings.swap_length + toolchange_settings.extra_prime;
       DEBUG_ECHOLNPGM("Negative ExtraPrime value - Swap Return Length has been reduced from ", toolchange_settings.swap_length, " to ", eswap);
       DEBUG_ECHOLNPGM("Loading Filament for T", active_extruder, " | Distance: ", eswap, " | Speed: ", fr_mm_s, "mm/s");
-      unscaled_e_move(eswap, fr_mm_s);
+      toolchange_e_move(eswap, fr_mm_s);
     }
 
     extruder_was_primed.set(active_extruder); // Log that this extruder has been primed
@@ -1010,7 +1040,7 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
     // Cutting retraction
     #if TOOLCHANGE_FS_WIPE_RETRACT
       DEBUG_ECHOLNPGM("Performing Cutting Retraction | Distance: ", -toolchange_settings.wipe_retract, " | Speed: ", MMM_TO_MMS(toolchange_settings.retract_speed), "mm/s");
-      unscaled_e_move(-toolchange_settings.wipe_retract, MMM_TO_MMS(toolchange_settings.retract_speed));
+      toolchange_e_move(-toolchange_settings.wipe_retract, MMM_TO_MMS(toolchange_settings.retract_speed));
     #endif
 
     // Leave E unchanged when priming
@@ -1150,7 +1180,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
 
   #elif HAS_MULTI_EXTRUDER
 
-    planner.synchronize();
+    toolchange_sync();
 
     #if ENABLED(DUAL_X_CARRIAGE)  // Only T0 allowed if the Printer is in DXC_DUPLICATION_MODE or DXC_MIRRORED_MODE
       if (new_tool != 0 && idex_is_duplicating())
@@ -1194,6 +1224,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
 
       #if ALL(TOOLCHANGE_FILAMENT_SWAP, HAS_FAN) && TOOLCHANGE_FS_FAN >= 0
         // Store and stop fan. Restored on any exit.
+        TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize()); // Keep the fan on for the print moves
         REMEMBER(fan, thermalManager.fan_speed[TOOLCHANGE_FS_FAN], 0);
       #endif
 
@@ -1204,7 +1235,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
           current_position.z += toolchange_settings.z_raise;
           TERN_(HAS_SOFTWARE_ENDSTOPS, NOMORE(current_position.z, soft_endstop.max.z));
           fast_line_to_current(Z_AXIS);
-          planner.synchronize();
+          toolchange_sync();
         }
       #endif
 
@@ -1220,7 +1251,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
             // Retract the old extruder if it was previously primed
             // To-Do: Should SingleNozzle always retract?
             DEBUG_ECHOLNPGM("Retracting Filament for T", old_tool, ". | Distance: ", toolchange_settings.swap_length, " | Speed: ", MMM_TO_MMS(toolchange_settings.retract_speed), "mm/s");
-            unscaled_e_move(-toolchange_settings.swap_length, MMM_TO_MMS(toolchange_settings.retract_speed));
+            toolchange_e_move(-toolchange_settings.swap_length, MMM_TO_MMS(toolchange_settings.retract_speed));
           }
         }
       #endif
@@ -1265,7 +1296,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
             );
           #endif
           planner.buffer_line(current_position, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE), old_tool);
-          planner.synchronize();
+          toolchange_sync();
         }
       #endif
 
@@ -1337,6 +1368,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
       if (should_move) {
 
         #if ANY(SINGLENOZZLE_STANDBY_TEMP, SINGLENOZZLE_STANDBY_FAN)
+          TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize()); // Finish with the old tool before the temperature change
           thermalManager.singlenozzle_change(old_tool, new_tool);
         #endif
 
@@ -1364,20 +1396,20 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
             DEBUG_ECHOLNPGM("Move back Z only");
 
             if (TERN1(TOOLCHANGE_PARK, toolchange_settings.enable_park))
-              do_blocking_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
+              toolchange_move_to_xy_z(current_position, destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
 
           #else
             // Move back to the original (or adjusted) position
             DEBUG_POS("Move back", destination);
 
             #if ENABLED(TOOLCHANGE_PARK)
-              if (toolchange_settings.enable_park) do_blocking_move_to_xy_z(destination, destination.z, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
+              if (toolchange_settings.enable_park) toolchange_move_to_xy_z(destination, destination.z, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
             #else
-              do_blocking_move_to_xy(destination, planner.settings.max_feedrate_mm_s[X_AXIS]* 0.5f);
+              toolchange_move_to_xy_z(destination, current_position.z, planner.settings.max_feedrate_mm_s[X_AXIS]* 0.5f);
 
               // If using MECHANICAL_SWITCHING extruder/nozzle, set HOTEND_OFFSET in Z axis after running EVENT_GCODE_TOOLCHANGE below.
               #if NONE(MECHANICAL_SWITCHING_EXTRUDER, MECHANICAL_SWITCHING_NOZZLE)
-                do_blocking_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
+                toolchange_move_to_xy_z(current_position, destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
                 SECONDARY_AXIS_CODE(
                   do_blocking_move_to_i(destination.i, planner.settings.max_feedrate_mm_s[I_AXIS]),
                   do_blocking_move_to_j(destination.j, planner.settings.max_feedrate_mm_s[J_AXIS]),
@@ -1414,17 +1446,23 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
           do_blocking_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
       #endif
 
+      #if ALL(TOOLCHANGE_QUEUED_MOVES, TOOLCHANGE_FILAMENT_SWAP, HAS_FAN) && TOOLCHANGE_FS_FAN >= 0
+        planner.synchronize(); // Keep the fan off for the swap moves
+      #endif
+
     } // (new_tool != old_tool)
 
-    planner.synchronize();
+    toolchange_sync();
 
     #if ENABLED(EXT_SOLENOID) && DISABLED(PARKING_EXTRUDER)
+      TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize());
       disable_all_solenoids();
       enable_solenoid(active_extruder);
     #endif
 
     #if HAS_PRUSA_MMU1
       if (new_tool >= E_STEPPERS) return invalid_extruder_error(new_tool);
+      TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize());
       select_multiplexed_stepper(new_tool);
     #endif
 
@@ -1433,7 +1471,10 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
       move_extruder_servo(active_extruder);
     #endif
 
-    TERN_(HAS_FANMUX, fanmux_switch(active_extruder));
+    #if HAS_FANMUX
+      TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize());
+      fanmux_switch(active_extruder);
+    #endif
 
     if (ENABLED(EVENT_GCODE_TOOLCHANGE_ALWAYS_RUN) || !no_move) {
 
@@ -1453,28 +1494,28 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
       switch (new_tool) {
         default: break;
         #ifdef EVENT_GCODE_TOOLCHANGE_T0
-          case 0: gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T0)); break;
+          case 0: TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize()); gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T0)); break;
         #endif
         #ifdef EVENT_GCODE_TOOLCHANGE_T1
-          case 1: gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T1)); break;
+          case 1: TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize()); gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T1)); break;
         #endif
         #ifdef EVENT_GCODE_TOOLCHANGE_T2
-          case 2: gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T2)); break;
+          case 2: TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize()); gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T2)); break;
         #endif
         #ifdef EVENT_GCODE_TOOLCHANGE_T3
-          case 3: gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T3)); break;
+          case 3: TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize()); gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T3)); break;
         #endif
         #ifdef EVENT_GCODE_TOOLCHANGE_T4
-          case 4: gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T4)); break;
+          case 4: TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize()); gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T4)); break;
         #endif
         #ifdef EVENT_GCODE_TOOLCHANGE_T5
-          case 5: gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T5)); break;
+          case 5: TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize()); gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T5)); break;
         #endif
         #ifdef EVENT_GCODE_TOOLCHANGE_T6
-          case 6: gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T6)); break;
+          case 6: TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize()); gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T6)); break;
         #endif
         #ifdef EVENT_GCODE_TOOLCHANGE_T7
-          case 7: gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T7)); break;
+          case 7: TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize()); gcode.process_subcommands_now(F(EVENT_GCODE_TOOLCHANGE_T7)); break;
         #endif
       }
 
@@ -1506,8 +1547,10 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
       #endif
 
       #ifdef EVENT_GCODE_AFTER_TOOLCHANGE
-        if (TERN1(DUAL_X_CARRIAGE, dual_x_carriage_mode == DXC_AUTO_PARK_MODE))
+        if (TERN1(DUAL_X_CARRIAGE, dual_x_carriage_mode == DXC_AUTO_PARK_MODE)) {
+          TERN_(TOOLCHANGE_QUEUED_MOVES, planner.synchronize());
           gcode.process_subcommands_now(F(EVENT_GCODE_AFTER_TOOLCHANGE));
+        }
       #endif
 
     } // !no_move
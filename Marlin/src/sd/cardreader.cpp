@@ -589,6 +589,8 @@ void CardReader::release() {
   else
     endFilePrintNow();
 
+  TERN_(SD_PRESCAN, file_index.close());
+
   flag.mounted = false;
   flag.workDirIsRoot = true;
   nrItems = -1;
@@ -744,6 +746,14 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
 
     selectFileByName(fname);
     ui.set_status(longFilename[0] ? longFilename : fname);
+
+    // Index a new print. Sub-procedures aren't indexed.
+    #if ENABLED(SD_PRESCAN)
+      if (subcall_type == 0)
+        file_index.open(*diveDir, fname, filesize);
+      else
+        file_index.close();
+    #endif
   }
   else
     openFailed(fname);
@@ -763,6 +773,7 @@ void CardReader::openFileWrite(const char * const path) {
   TERN_(HAS_MEDIA_SUBCALLS, file_subcall_ctr = 0);
 
   abortFilePrintNow();
+  TERN_(SD_PRESCAN, file_index.close());
 
   MediaFile *diveDir;
   const char * const fname = diveToFile(false, diveDir, path);
@@ -50,6 +50,10 @@ extern const char M23_STR[], M24_STR[];
 #include "SdFile.h"
 #include "disk_io_driver.h"
 
+#if ENABLED(SD_PRESCAN)
+  #include "file_index.h"
+#endif
+
 #if ENABLED(USB_FLASH_DRIVE_SUPPORT)
   #include "usb_flashdrive/Sd2Card_FlashDrive.h"
 #endif
@@ -182,12 +186,18 @@ public:
   #if HAS_PRINT_PROGRESS_PERMYRIAD
     static uint16_t permyriadDone() {
       if (flag.sdprintdone) return 10000;
+      #if ENABLED(SD_PRESCAN)
+        if (isFileOpen() && file_index.ready()) return file_index.permyriad(sdpos);
+      #endif
       if (isFileOpen() && filesize) return sdpos / ((filesize + 9999) / 10000);
       return 0;
     }
   #endif
   static uint8_t percentDone() {
     if (flag.sdprintdone) return 100;
+    #if ENABLED(SD_PRESCAN)
+      if (isFileOpen() && file_index.ready()) return file_index.permyriad(sdpos) / 100;
+    #endif
     if (isFileOpen() && filesize) return sdpos / ((filesize + 99) / 100);
     return 0;
   }
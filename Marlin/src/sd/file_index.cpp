@@ -0,0 +1,368 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_PRESCAN)
+
+#include "file_index.h"
+#include "cardreader.h"
+#include "../gcode/queue.h"
+#include "../module/planner.h"
+
+#define FILE_INDEX_MAGIC    0x5844494DUL  // "MIDX"
+#define FILE_INDEX_VERSION  1
+#define FILE_INDEX_BLOCK    512           // Bytes to scan per call
+#define MIN_LAYER_STEP      0.04f         // Smallest Z change (mm) counted as a new layer
+
+FileIndex file_index;
+
+MediaFile FileIndex::source, FileIndex::idx;
+bool FileIndex::scanning; // = false
+file_index_header_t FileIndex::header;
+uint32_t FileIndex::bracket;
+file_index_layer_t FileIndex::lo, FileIndex::hi;
+
+//
+// Scanner state
+//
+static char line[MAX_CMD_SIZE];
+static uint8_t line_len;
+static uint32_t line_pos;
+static bool in_comment;
+
+//
+// A simple motion model for the time estimate. Every move accelerates from
+// its entry speed to its feedrate and back, with the entry speed set by the
+// angle to the previous move. Temperature waits and homing aren't counted.
+//
+static struct {
+  float x, y, z, e;       // Logical position
+  float ux, uy, uz;       // Direction of the previous move
+  float fr_mm_s, last_v;  // Feedrate and speed of the previous move
+  float scale;            // 25.4 for G20 inches
+  bool rel_xyz, rel_e;
+  uint32_t ms;            // Estimated time so far
+  float ms_frac;
+  float layer_z;          // Z of the last layer
+  uint32_t z_pos, z_ms;   // Line and time where Z last changed
+  int8_t object, z_object;
+} model;
+
+static void model_reset() {
+  model = {};
+  model.fr_mm_s = 10.0f;
+  model.scale = 1.0f;
+  model.layer_z = -1.0f;
+  model.object = model.z_object = -1;
+}
+
+static void model_add_time(const float sec) {
+  model.ms_frac += sec * 1000.0f;
+  const uint32_t whole = uint32_t(model.ms_frac);
+  model.ms += whole;
+  model.ms_frac -= whole;
+}
+
+// Time (s) to move d mm at up to v mm/s, starting and ending at ve mm/s
+static float move_time(const float d, float v, const float ve, const float a) {
+  if (v <= 0) return 0;
+  if (a > 0) {
+    NOMORE(v, SQRT(sq(ve) + a * d));  // The fastest speed the move can reach and still slow down to ve
+    return d / v + sq(v - ve) / (a * v);
+  }
+  return d / v;
+}
+
+void FileIndex::open(MediaFile &dir, const char * const fname, const uint32_t size) {
+  close();
+
+  // The sidecar is FILENAME.IDX
+  char iname[FILENAME_LENGTH];
+  strlcpy(iname, fname, FILENAME_LENGTH);
+  char * const dot = strrchr(iname, '.');
+  if (dot) *dot = '\0';
+  if (strlen(iname) > 8) return;
+  strcat(iname, ".IDX");
+  if (strcasecmp(iname, fname) == 0) return;  // An index can't index itself
+
+  MediaFile d = dir;
+
+  // Use the existing index if it's for this file
+  if (idx.open(&d, iname, O_RDWR)) {
+    if (idx.read(&header, sizeof(header)) == int16_t(sizeof(header))
+      && header.magic == FILE_INDEX_MAGIC && header.version == FILE_INDEX_VERSION
+      && header.complete && header.source_size == size
+    ) {
+      bracket = UINT32_MAX;
+      return;
+    }
+    idx.close();
+    header = {};
+  }
+
+  // Start a new index
+  if (!idx.open(&d, iname, O_CREAT | O_RDWR | O_TRUNC)) return;
+  if (!source.open(&d, fname, O_READ)) { idx.close(); return; }
+
+  header = { FILE_INDEX_MAGIC, FILE_INDEX_VERSION, 0, size, 0, 0 };
+  idx.write(&header, sizeof(header));
+
+  model_reset();
+  line_len = 0;
+  line_pos = 0;
+  in_comment = false;
+  scanning = true;
+}
+
+void FileIndex::close() {
+  scanning = false;
+  if (source.isOpen()) source.close();
+  if (idx.isOpen()) idx.close();
+  header = {};
+}
+
+/**
+ * Scan the next block of the file, one line at a time.
+ * While printing, only scan when the command queue is full,
+ * so the print always gets the card first.
+ */
+void FileIndex::scan_block() {
+  if (IS_SD_PRINTING() && !queue.ring_buffer.full()) return;
+
+  for (uint16_t n = FILE_INDEX_BLOCK; n--;) {
+    const int16_t c = source.read();
+    const bool eof = c < 0;
+    if (eof && source.curPosition() < header.source_size) { close(); return; } // Read error
+
+    if (eof || c == '\n' || c == '\r') {
+      line[line_len] = '\0';
+      if (line_len) scan_line(line, line_pos);
+      line_len = 0;
+      in_comment = false;
+      line_pos = source.curPosition();
+      if (eof) return finish();
+    }
+    else if (c == ';')
+      in_comment = true;
+    else if (!in_comment && line_len < MAX_CMD_SIZE - 1)
+      line[line_len++] = c;
+  }
+}
+
+/**
+ * Apply one line of G-code to the model
+ */
+void FileIndex::scan_line(char * const cmd, const uint32_t cmd_pos) {
+  enum : uint8_t { W_G, W_M, W_X, W_Y, W_Z, W_E, W_F, W_I, W_J, W_R, W_P, W_S, W_T };
+  float w[W_T + 1];
+  uint16_t seen = 0;
+
+  // Get the words used by the model
+  for (char *p = cmd; *p;) {
+    int8_t i;
+    switch (*p++) {
+      case 'G': i = W_G; break;  case 'M': i = W_M; break;
+      case 'X': i = W_X; break;  case 'Y': i = W_Y; break;
+      case 'Z': i = W_Z; break;  case 'E': i = W_E; break;
+      case 'F': i = W_F; break;  case 'I': i = W_I; break;
+      case 'J': i = W_J; break;  case 'R': i = W_R; break;
+      case 'P': i = W_P; break;  case 'S': i = W_S; break;
+      case 'T': i = W_T; break;
+      default: continue;
+    }
+    char *end;
+    const float v = strtof(p, &end);
+    if (end == p) continue;
+    w[i] = v;
+    SBI(seen, i);
+    p = end;
+  }
+
+  #define SEEN(W) TEST(seen, W_##W)
+
+  if (SEEN(M)) {
+    switch (int(w[W_M])) {
+      case 82: model.rel_e = false; break;
+      case 83: model.rel_e = true; break;
+      case 486:
+        if (SEEN(T)) model.object = -1;
+        if (SEEN(S)) model.object = int8_t(w[W_S]);
+        break;
+    }
+    return;
+  }
+
+  if (!SEEN(G)) return;
+
+  const uint8_t g = uint8_t(w[W_G]);
+  switch (g) {
+    case 0 ... 3: break;
+    case 4: model_add_time(SEEN(S) ? w[W_S] : SEEN(P) ? w[W_P] * 0.001f : 0); return;
+    case 20: model.scale = 25.4f; return;
+    case 21: model.scale = 1.0f; return;
+    case 90: model.rel_xyz = model.rel_e = false; return;
+    case 91: model.rel_xyz = model.rel_e = true; return;
+    case 92:
+      if (SEEN(X)) model.x = w[W_X] * model.scale;
+      if (SEEN(Y)) model.y = w[W_Y] * model.scale;
+      if (SEEN(Z)) model.z = w[W_Z] * model.scale;
+      if (SEEN(E)) model.e = w[W_E] * model.scale;
+      return;
+    default: return;
+  }
+
+  // G0-G3 move
+  #define TARGET(A, W) (SEEN(W) ? (model.rel_xyz ? model.A : 0) + w[W_##W] * model.scale : model.A)
+  const float tx = TARGET(x, X), ty = TARGET(y, Y), tz = TARGET(z, Z),
+              te = SEEN(E) ? (model.rel_e ? model.e : 0) + w[W_E] * model.scale : model.e;
+  if (SEEN(F) && w[W_F] > 0) model.fr_mm_s = w[W_F] * model.scale / 60.0f;
+
+  const float dx = tx - model.x, dy = ty - model.y, dz = tz - model.z, de = te - model.e;
+  const float chord = SQRT(sq(dx) + sq(dy));
+
+  // Path length, including arcs
+  float len = SQRT(sq(chord) + sq(dz));
+  if (g >= 2) {
+    float arc = 0;
+    if (SEEN(R) && w[W_R] != 0) {
+      const float r = w[W_R] * model.scale, ra = ABS(r);
+      float angle = 2.0f * asinf(_MIN(1.0f, chord / (2.0f * ra)));
+      if (r < 0) angle = float(RADIANS(360)) - angle;
+      arc = ra * angle;
+    }
+    else if (SEEN(I) || SEEN(J)) {
+      const float i = SEEN(I) ? w[W_I] * model.scale : 0, j = SEEN(J) ? w[W_J] * model.scale : 0,
+                  cx = model.x + i, cy = model.y + j, r = SQRT(sq(i) + sq(j));
+      float sweep = ATAN2(ty - cy, tx - cx) - ATAN2(model.y - cy, model.x - cx);
+      if (g == 2) { if (sweep >= 0) sweep -= float(RADIANS(360)); }
+      else if (sweep <= 0) sweep += float(RADIANS(360));
+      arc = r * ABS(sweep);
+    }
+    if (arc > 0) len = SQRT(sq(arc) + sq(dz));
+  }
+
+  // Note where Z changes, for the layer that may start here
+  if (ABS(dz) > 0.0001f) {
+    model.z_pos = cmd_pos;
+    model.z_ms = model.ms;
+    model.z_object = model.object;
+  }
+
+  // Speed and acceleration for the move
+  const bool extruding = de > 0 && chord > 0;
+  float v = model.fr_mm_s, a;
+  if (len > 0) {
+    NOMORE(v, chord > 0 ? PLANNER_XY_FEEDRATE_MM_S : TERN(HAS_Z_AXIS, planner.settings.max_feedrate_mm_s[Z_AXIS], v));
+    a = de ? planner.settings.acceleration : planner.settings.travel_acceleration;
+  }
+  else {
+    len = ABS(de);
+    TERN_(HAS_EXTRUDERS, NOMORE(v, planner.settings.max_feedrate_mm_s[E_AXIS]));
+    a = planner.settings.retract_acceleration;
+  }
+
+  if (len > 0) {
+    // Entry speed from the angle with the previous move
+    float ux = 0, uy = 0, uz = 0, ve = 0;
+    if (chord > 0 || dz) {
+      const float inv = 1.0f / SQRT(sq(chord) + sq(dz));
+      ux = dx * inv; uy = dy * inv; uz = dz * inv;
+      const float cos_theta = ux * model.ux + uy * model.uy + uz * model.uz;
+      ve = _MIN(v, model.last_v) * (1.0f + cos_theta) * 0.5f;
+    }
+    model_add_time(move_time(len, v, ve, a));
+    model.ux = ux; model.uy = uy; model.uz = uz;
+    model.last_v = (chord > 0 || dz) ? v : 0;
+  }
+
+  model.x = tx; model.y = ty; model.z = tz; model.e = te;
+
+  // The first extrusion at a new height starts a layer
+  if (extruding && (model.layer_z < 0 || ABS(tz - model.layer_z) >= MIN_LAYER_STEP)) {
+    model.layer_z = tz;
+    const file_index_layer_t rec = { model.z_pos, tz, model.z_ms, model.z_object, { 0 } };
+    add_layer(rec);
+  }
+}
+
+void FileIndex::add_layer(const file_index_layer_t &rec) {
+  if (idx.write(&rec, sizeof(rec)) != int16_t(sizeof(rec))) { close(); return; }
+  header.layers++;
+}
+
+void FileIndex::finish() {
+  scanning = false;
+  source.close();
+
+  header.total_ms = model.ms;
+  header.complete = 1;
+  idx.seekSet(0);
+  if (idx.write(&header, sizeof(header)) != int16_t(sizeof(header)) || !idx.sync()) { close(); return; }
+
+  bracket = UINT32_MAX;
+  SERIAL_ECHO_MSG("Indexed ", header.layers, " layers. Estimated time ", header.total_ms / 1000UL, "s");
+}
+
+bool FileIndex::get_layer(const uint32_t layer, file_index_layer_t &rec) {
+  if (!ready() || layer >= header.layers) return false;
+  return idx.seekSet(sizeof(header) + layer * sizeof(rec)) && idx.read(&rec, sizeof(rec)) == int16_t(sizeof(rec));
+}
+
+/**
+ * Find the layers before and after sdpos. The last pair found
+ * is kept, so this only reads the card at a new layer.
+ */
+bool FileIndex::find_bracket(const uint32_t sdpos) {
+  if (bracket <= header.layers && sdpos >= lo.sdpos && sdpos < hi.sdpos) return true;
+
+  // Binary search for the first layer that starts after sdpos
+  uint32_t l = 0, h = header.layers;
+  file_index_layer_t rec;
+  while (l < h) {
+    const uint32_t m = (l + h) / 2;
+    if (!get_layer(m, rec)) return false;
+    if (rec.sdpos > sdpos) h = m; else l = m + 1;
+  }
+
+  if (l == 0)
+    lo = { 0, 0, 0, -1, { 0 } };
+  else if (!get_layer(l - 1, lo))
+    return false;
+
+  if (l == header.layers)
+    hi = { header.source_size + 1, 0, header.total_ms, -1, { 0 } };
+  else if (!get_layer(l, hi))
+    return false;
+
+  bracket = l;
+  return true;
+}
+
+uint16_t FileIndex::permyriad(const uint32_t sdpos) {
+  if (!header.total_ms || !find_bracket(sdpos)) return 0;
+  const float span = hi.sdpos - lo.sdpos,
+              ms = lo.ms + (span ? (sdpos - lo.sdpos) / span : 0) * float(hi.ms - lo.ms);
+  return _MIN(10000U, uint16_t(ms * 10000.0f / header.total_ms));
+}
+
+#endif // SD_PRESCAN
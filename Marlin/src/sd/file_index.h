@@ -0,0 +1,92 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * file_index.h - Pre-scan a G-code file into a sidecar index
+ *
+ * When a file is selected it's scanned in the background, a block at a time
+ * from idle(), with a simple motion model to estimate the print time. Each
+ * layer start is written to FILENAME.IDX beside the file, which is reused
+ * the next time the same file is selected.
+ *
+ * With a complete index the print progress is based on estimated time
+ * instead of bytes, and M26 L can go straight to the start of any layer.
+ * Power-loss recovery keeps its own exact file position and doesn't use it.
+ */
+
+#include "SdFile.h"
+
+typedef struct {
+  uint32_t magic;         // FILE_INDEX_MAGIC
+  uint16_t version;       // FILE_INDEX_VERSION
+  uint16_t complete;      // Non-zero once the whole file has been scanned
+  uint32_t source_size;   // Size of the G-code file
+  uint32_t layers;        // Number of layer records that follow
+  uint32_t total_ms;      // Estimated print time
+} file_index_header_t;
+
+typedef struct {
+  uint32_t sdpos;         // Position of the line that moves to the layer
+  float z;                // Layer height
+  uint32_t ms;            // Estimated print time before the layer
+  int8_t object;          // Object started with M486 S, or -1
+  uint8_t reserved[3];
+} file_index_layer_t;
+
+class FileIndex {
+public:
+  // A file was selected. Use its index or begin a new scan.
+  static void open(MediaFile &dir, const char * const fname, const uint32_t size);
+  static void close();
+
+  // Scan the next block of the file. Called from idle().
+  static void task() { if (scanning) scan_block(); }
+
+  // Is the index complete?
+  static bool ready() { return header.complete; }
+  static uint32_t layer_count() { return header.layers; }
+  static uint32_t total_ms() { return header.total_ms; }
+
+  // Progress in units of 0.01%, based on the estimated time to reach sdpos
+  static uint16_t permyriad(const uint32_t sdpos);
+
+  // Get a layer record. Return false if there's no such layer.
+  static bool get_layer(const uint32_t layer, file_index_layer_t &rec);
+
+private:
+  static MediaFile source, idx;
+  static bool scanning;
+  static file_index_header_t header;
+
+  // Cached layer records on either side of the last position looked up
+  static uint32_t bracket;
+  static file_index_layer_t lo, hi;
+
+  static void scan_block();
+  static void scan_line(char * const line, const uint32_t line_pos);
+  static void add_layer(const file_index_layer_t &rec);
+  static void finish();
+  static bool find_bracket(const uint32_t sdpos);
+};
+
+extern FileIndex file_index;
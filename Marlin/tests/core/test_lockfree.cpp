@@ -0,0 +1,111 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * The handoff between the main core and the motion core (see MOTION_CORE),
+ * with two threads standing in for the two cores.
+ */
+
+#include "../test/unit_tests.h"
+#include "src/libs/lockfree.h"
+
+#include <thread>
+
+MARLIN_TEST(lockfree, SPSCQueue_push_peek_pop) {
+  SPSCQueue<int, 4> q;
+  TEST_ASSERT_TRUE(q.empty());
+  TEST_ASSERT_NULL(q.peek());
+
+  TEST_ASSERT_TRUE(q.push(1));
+  TEST_ASSERT_TRUE(q.push(2));
+  TEST_ASSERT_TRUE(q.push(3));
+  TEST_ASSERT_FALSE(q.push(4)); // One slot is kept free
+  TEST_ASSERT_EQUAL(3, q.count());
+
+  TEST_ASSERT_EQUAL(1, *q.peek());
+  q.pop();
+  TEST_ASSERT_EQUAL(2, *q.peek());
+  q.pop();
+  TEST_ASSERT_TRUE(q.push(4));
+  TEST_ASSERT_EQUAL(3, *q.peek());
+  q.pop();
+  TEST_ASSERT_EQUAL(4, *q.peek());
+  q.pop();
+  TEST_ASSERT_TRUE(q.empty());
+}
+
+// Like motion_cmd_t, an item too large to be copied atomically
+struct test_cmd_t { uint32_t seq, a, b, c; };
+
+MARLIN_TEST(lockfree, SPSCQueue_two_threads) {
+  static SPSCQueue<test_cmd_t, 8> q;
+  constexpr uint32_t count = 100000;
+
+  std::thread producer([]{
+    for (uint32_t i = 1; i <= count; ++i) {
+      const test_cmd_t cmd = { i, i * 3, i * 5, i * 7 };
+      while (!q.push(cmd)) std::this_thread::yield();
+    }
+  });
+
+  // Every item arrives complete, once, in order
+  uint32_t expected = 1, errors = 0;
+  while (expected <= count) {
+    const test_cmd_t * const cmd = q.peek();
+    if (!cmd) { std::this_thread::yield(); continue; }
+    if (cmd->seq != expected || cmd->a != expected * 3 || cmd->b != expected * 5 || cmd->c != expected * 7) errors++;
+    q.pop();
+    expected++;
+  }
+
+  producer.join();
+  TEST_ASSERT_EQUAL(0, errors);
+  TEST_ASSERT_TRUE(q.empty());
+}
+
+MARLIN_TEST(lockfree, SeqLock_no_torn_reads) {
+  struct pos_t { int32_t x, y, z, e; };
+  static SeqLock<pos_t> lock;
+  static bool done;
+  constexpr int32_t count = 100000;
+
+  lock.write({ 0, 0, 0, 0 });
+  done = false;
+
+  std::thread writer([]{
+    for (int32_t i = 1; i <= count; ++i) lock.write({ i, -i, 2 * i, 3 * i });
+    lf_store(done, true);
+  });
+
+  // A reader sees each position whole, and never goes back in time
+  uint32_t errors = 0;
+  int32_t last = 0;
+  while (!lf_load(done)) {
+    const pos_t p = lock.read();
+    if (p.y != -p.x || p.z != 2 * p.x || p.e != 3 * p.x || p.x < last) errors++;
+    last = p.x;
+  }
+
+  writer.join();
+  TEST_ASSERT_EQUAL(0, errors);
+  TEST_ASSERT_EQUAL(count, lock.read().x);
+}
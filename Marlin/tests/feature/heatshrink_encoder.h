@@ -0,0 +1,58 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * A simple heatshrink encoder (window 8, lookahead 4) for tests of the
+ * decoders. Each byte is a literal or the longest match in the window.
+ */
+
+#include <stdint.h>
+#include <vector>
+
+inline std::vector<uint8_t> heatshrink_encode(const std::vector<uint8_t> &in) {
+  std::vector<uint8_t> out;
+  uint8_t bits = 0, nbits = 0;
+  auto put = [&](const uint16_t v, const uint8_t n) {
+    for (int8_t b = n - 1; b >= 0; --b) {
+      bits = (bits << 1) | ((v >> b) & 1);
+      if (++nbits == 8) { out.push_back(bits); bits = nbits = 0; }
+    }
+  };
+  for (size_t i = 0; i < in.size();) {
+    size_t best_len = 0, best_off = 0;
+    for (size_t off = 1; off <= 256 && off <= i; ++off) {
+      size_t len = 0;
+      while (len < 16 && i + len < in.size() && in[i + len] == in[i + len - off]) len++;
+      if (len > best_len) { best_len = len; best_off = off; }
+    }
+    if (best_len > 1) {
+      put(0, 1); put(best_off - 1, 8); put(best_len - 1, 4);
+      i += best_len;
+    }
+    else {
+      put(1, 1); put(in[i++], 8);
+    }
+  }
+  if (nbits) out.push_back(bits << (8 - nbits));
+  return out;
+}
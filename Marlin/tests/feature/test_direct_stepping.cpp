@@ -0,0 +1,225 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Direct stepping pages sent through the LINUX HAL serial port and read
+ * by the command queue, the way the main loop and idle() read them.
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(DIRECT_STEPPING)
+
+#include <src/feature/direct_stepping.h>
+#include <src/gcode/queue.h>
+#include "heatshrink_encoder.h"
+
+#include <chrono>
+#include <vector>
+
+using namespace DirectStepping;
+
+typedef std::vector<uint8_t> bytes_t;
+
+static void start_pages() {
+  MYSERIAL1.host_connected = false; // Drop replies, nobody is reading them
+  queue.clear();
+  page_manager.init();
+}
+
+// Send bytes as the host would, in pieces that fit the RX buffer
+static void send(const bytes_t &bytes, size_t &i) {
+  for (uint8_t n = 0; n < 100 && i < bytes.size(); ++n) MYSERIAL1.receive_buffer.write(bytes[i++]);
+}
+
+// Pages and commands read by the main loop
+static void loopback(const bytes_t &frame) {
+  for (size_t i = 0; i < frame.size();) {
+    send(frame, i);
+    while (MYSERIAL1.available()) queue.get_available_commands();
+  }
+}
+
+static bytes_t gcode(const char * const line) { return bytes_t(line, line + strlen(line)); }
+
+// A page of step patterns, as for a move speeding up and slowing down
+static bytes_t test_page(const uint8_t seed) {
+  bytes_t page(Config::PAGE_SIZE);
+  for (int i = 0; i < Config::PAGE_SIZE; ++i) page[i] = (seed + i / 32) & 0xAA;
+  return page;
+}
+
+static bytes_t raw_frame(const uint8_t idx, const bytes_t &data) {
+  bytes_t frame = { '\n', Config::CONTROL_CHAR, idx };
+  if (!Config::DIRECTIONAL) frame.push_back(uint8_t(data.size())); // 0 is a full page
+  uint8_t checksum = 0;
+  for (const uint8_t c : data) { frame.push_back(c); checksum ^= c; }
+  frame.push_back(checksum);
+  return frame;
+}
+
+static bool page_is(const uint8_t idx, const bytes_t &data) {
+  return memcmp(page_manager.get_page(idx), data.data(), data.size()) == 0;
+}
+
+MARLIN_TEST(direct_stepping, raw_page) {
+  start_pages();
+  const bytes_t page = test_page(1);
+  loopback(raw_frame(0, page));
+  TEST_ASSERT_EQUAL(PageState::OK, page_manager.get_page_state(0));
+  TEST_ASSERT_TRUE(page_is(0, page));
+
+  // A bad checksum fails the page, and the host clears it with a zero
+  bytes_t frame = raw_frame(1, page);
+  frame.back() ^= 1;
+  loopback(frame);
+  TEST_ASSERT_EQUAL(PageState::FAIL, page_manager.get_page_state(1));
+  loopback({ '\n', Config::CONTROL_CHAR, 1, 0 });
+  TEST_ASSERT_EQUAL(PageState::FREE, page_manager.get_page_state(1));
+}
+
+MARLIN_TEST(direct_stepping, pages_between_commands) {
+  start_pages();
+  bytes_t stream = gcode("G4 S0\n");
+  const bytes_t frame = raw_frame(2, test_page(2));
+  stream.insert(stream.end(), frame.begin(), frame.end());
+  const bytes_t m400 = gcode("\nM400\n");
+  stream.insert(stream.end(), m400.begin(), m400.end());
+  loopback(stream);
+  TEST_ASSERT_EQUAL(PageState::OK, page_manager.get_page_state(2));
+  TEST_ASSERT_EQUAL(2, queue.ring_buffer.length);
+  TEST_ASSERT_EQUAL_STRING("G4 S0", queue.ring_buffer.peek_next_command_string());
+}
+
+MARLIN_TEST(direct_stepping, pages_while_queue_full) {
+  start_pages();
+  while (queue.enqueue_one("G4 S0")) { /* fill the queue */ }
+
+  // The main loop reads nothing with the queue full, so the page comes through idle()
+  bytes_t stream = raw_frame(3, test_page(3));
+  const bytes_t m400 = gcode("\nM400\n");
+  stream.insert(stream.end(), m400.begin(), m400.end());
+  for (size_t i = 0; i < stream.size();) {
+    send(stream, i);
+    queue.get_available_commands();
+    queue.receive_pages();
+  }
+  TEST_ASSERT_EQUAL(PageState::OK, page_manager.get_page_state(3));
+  TEST_ASSERT_TRUE(page_is(3, test_page(3)));
+
+  // The command after the page waits for the main loop
+  TEST_ASSERT_TRUE(MYSERIAL1.available() > 0);
+  queue.clear();
+  queue.get_available_commands();
+  TEST_ASSERT_EQUAL(1, queue.ring_buffer.length);
+  TEST_ASSERT_EQUAL_STRING("M400", queue.ring_buffer.peek_next_command_string());
+}
+
+MARLIN_TEST(direct_stepping, page_count) {
+  start_pages();
+  TEST_ASSERT_EQUAL(STEPPER_PAGES, page_manager.page_count());
+  TEST_ASSERT_FALSE(page_manager.set_page_count(0));
+  TEST_ASSERT_FALSE(page_manager.set_page_count(STEPPER_PAGES + 1));
+  TEST_ASSERT_TRUE(page_manager.set_page_count(4));
+  TEST_ASSERT_EQUAL(4, page_manager.page_count());
+
+  // Not while a page is in use
+  loopback(raw_frame(2, test_page(2)));
+  TEST_ASSERT_FALSE(page_manager.set_page_count(STEPPER_PAGES));
+  page_manager.free_page(2);
+  TEST_ASSERT_TRUE(page_manager.set_page_count(STEPPER_PAGES));
+}
+
+#if ENABLED(DIRECT_STEPPING_COMPRESSION)
+
+  static bytes_t packed_frame(const uint8_t idx, const bytes_t &data) {
+    const bytes_t packed = heatshrink_encode(data);
+    bytes_t frame = { '\n', Config::PACKED_CHAR, idx, uint8_t(packed.size()), uint8_t(packed.size() >> 8) };
+    uint8_t checksum = 0;
+    for (const uint8_t c : packed) { frame.push_back(c); checksum ^= c; }
+    frame.push_back(checksum);
+    return frame;
+  }
+
+  MARLIN_TEST(direct_stepping, packed_page) {
+    start_pages();
+    const bytes_t page = test_page(3);
+    const bytes_t frame = packed_frame(3, page);
+    TEST_ASSERT_TRUE(frame.size() < raw_frame(3, page).size() / 4);
+    loopback(frame);
+    TEST_ASSERT_EQUAL(PageState::OK, page_manager.get_page_state(3));
+    TEST_ASSERT_TRUE(page_is(3, page));
+
+    // Raw and packed pages can be mixed
+    loopback(raw_frame(4, test_page(4)));
+    loopback(packed_frame(5, test_page(5)));
+    TEST_ASSERT_EQUAL(PageState::OK, page_manager.get_page_state(4));
+    TEST_ASSERT_EQUAL(PageState::OK, page_manager.get_page_state(5));
+    TEST_ASSERT_TRUE(page_is(5, test_page(5)));
+  }
+
+  MARLIN_TEST(direct_stepping, packed_page_too_big) {
+    start_pages();
+    bytes_t data = test_page(6);
+    data.push_back(0);
+    loopback(packed_frame(6, data));
+    TEST_ASSERT_EQUAL(PageState::FAIL, page_manager.get_page_state(6));
+
+    // The next page is fine
+    loopback(packed_frame(7, test_page(7)));
+    TEST_ASSERT_EQUAL(PageState::OK, page_manager.get_page_state(7));
+  }
+
+#endif // DIRECT_STEPPING_COMPRESSION
+
+// Pages per second through the serial port and page manager
+static double pages_per_second(bytes_t (*make_frame)(const uint8_t, const bytes_t&), size_t &wire_bytes) {
+  constexpr int count = 2000;
+  start_pages();
+  const bytes_t frame = make_frame(0, test_page(8));
+  wire_bytes = frame.size();
+  int errors = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; ++i) {
+    loopback(frame);
+    if (page_manager.get_page_state(0) != PageState::OK) errors++;
+    page_manager.free_page(0);
+  }
+  const std::chrono::duration<double> secs = std::chrono::steady_clock::now() - start;
+  TEST_ASSERT_EQUAL(0, errors);
+  return count / secs.count();
+}
+
+MARLIN_TEST(direct_stepping, throughput) {
+  size_t raw_bytes;
+  const double raw_rate = pages_per_second(raw_frame, raw_bytes);
+  printf("raw: %u bytes/page, %.0f pages/s\n", unsigned(raw_bytes), raw_rate);
+  #if ENABLED(DIRECT_STEPPING_COMPRESSION)
+    // On the wire a packed page is much smaller than a raw page
+    size_t packed_bytes;
+    const double packed_rate = pages_per_second(packed_frame, packed_bytes);
+    printf("packed: %u bytes/page, %.0f pages/s\n", unsigned(packed_bytes), packed_rate);
+    TEST_ASSERT_TRUE(packed_bytes * 4 < raw_bytes);
+  #endif
+}
+
+#endif // DIRECT_STEPPING
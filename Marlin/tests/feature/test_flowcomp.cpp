@@ -0,0 +1,127 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Flow compensation fed with a made-up filament, one block at a time.
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(FILWIDTH_FLOW_COMPENSATION)
+
+#include <src/feature/flowcomp.h>
+#include <src/feature/filwidth.h>
+
+constexpr float steps_per_mm = 100, block_mm = 1, delay_mm = 140;
+
+// A thin stretch of filament from 100mm to 150mm
+static float width_at(const float mm) { return WITHIN(mm, 100, 150) ? 1.70f : 1.75f; }
+
+static float seen_mm; // Filament motion seen by the motion sensor
+
+static void start() {
+  seen_mm = 0;
+  planner.mm_per_step[E_AXIS] = 1.0f / steps_per_mm;
+  flowcomp.fed_steps = 0;
+  flowcomp.planned_mm = 0;
+  filwidth.nominal_mm = 1.75f;
+  filwidth.measured_mm = 1.75f;
+  filwidth.set_delay_cm(delay_mm / 10);
+  filwidth.enable(true);
+  flowcomp.reset();
+}
+
+// Plan a block, finish it, then take a reading. Return the correction.
+static float feed_block(const float width, const float motion=1.0f) {
+  const float f = flowcomp.e_factor(block_mm);
+  flowcomp.advance_e(block_mm * f);
+
+  block_t b{};
+  b.steps.e = LROUND(block_mm * f * steps_per_mm);
+  b.direction_bits.e = true;
+  flowcomp.block_completed(&b);
+
+  filwidth.measured_mm = width;
+  #if HAS_FLOWCOMP_ENCODER
+    // The sensor sees the filament move by 'motion' times the feed
+    const float moved = block_mm * f * motion;
+    for (int32_t i = FLOOR((seen_mm + moved) / (FLOWCOMP_ENCODER_MM)) - FLOOR(seen_mm / (FLOWCOMP_ENCODER_MM)); i > 0; --i)
+      flowcomp.encoder_edge();
+    seen_mm += moved;
+  #else
+    UNUSED(motion);
+  #endif
+  flowcomp.update();
+  return f;
+}
+
+MARLIN_TEST(flowcomp, delayed_width) {
+  start();
+  const float thin = sq(1.75f / 1.70f);
+  float fed = 0;
+  while (fed < 400) {
+    // The filament at the sensor is the filament fed so far. Leave out the slip correction.
+    const float slip = TERN(HAS_FLOWCOMP_ENCODER, flowcomp.slip, 1.0f),
+                f = feed_block(width_at(fed)) / slip,
+                mid = fed + block_mm * f * slip * 0.5f - delay_mm;
+    // The correction follows the thin stretch when it reaches the nozzle
+    if (WITHIN(mid, 100 + FLOWCOMP_SEGMENT_MM, 150 - FLOWCOMP_SEGMENT_MM))
+      TEST_ASSERT_FLOAT_WITHIN(0.002f, thin, f);
+    else if (mid < 100 - FLOWCOMP_SEGMENT_MM || mid > 150 + FLOWCOMP_SEGMENT_MM)
+      TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, f);
+    fed = flowcomp.fed_mm();
+  }
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, fed, flowcomp.planned_mm);
+
+  // Statistics
+  TEST_ASSERT_TRUE(flowcomp.samples > 300);
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.05f, flowcomp.err_max);
+  TEST_ASSERT_FLOAT_WITHIN(0.02f, 1.0f, flowcomp.factor_min);
+  TEST_ASSERT_FLOAT_WITHIN(0.02f, thin, flowcomp.factor_max);
+}
+
+MARLIN_TEST(flowcomp, limits) {
+  start();
+  // Far too thin, but within the error margin
+  float f = 1;
+  for (uint16_t i = 0; i < 300; ++i) f = feed_block(1.50f);
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, 1.0f + (FLOWCOMP_MAX_CORRECTION) * 0.01f, f);
+
+  // Not used with the sensor off
+  filwidth.enable(false);
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, 1.0f, flowcomp.e_factor(block_mm));
+}
+
+#if HAS_FLOWCOMP_ENCODER
+
+  MARLIN_TEST(flowcomp, slip) {
+    start();
+    // The extruder slips, so the filament moves 5% less than fed
+    float f = 1;
+    for (uint16_t i = 0; i < 3000; ++i) f = feed_block(1.75f, 0.95f);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 1.0f / 0.95f, flowcomp.slip);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 1.0f / 0.95f, f);
+  }
+
+#endif
+
+#endif // FILWIDTH_FLOW_COMPENSATION
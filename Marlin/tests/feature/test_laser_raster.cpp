@@ -0,0 +1,154 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * M650 raster lines: the base64 upload and the ring of lines handed to blocks
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(LASER_RASTER)
+
+#include <src/feature/laser_raster.h>
+#include <src/feature/spindle_laser.h>
+#include <src/module/planner.h>
+#include <src/module/settings.h>
+
+MARLIN_TEST(laser_raster, base64_decode) {
+  laser_raster.clear();
+
+  // Padding and spaces are skipped. Each call takes whole groups of 4.
+  TEST_ASSERT_TRUE(laser_raster.append_base64("AAEC"));
+  TEST_ASSERT_TRUE(laser_raster.append_base64(" /w== "));
+  TEST_ASSERT_EQUAL(4, laser_raster.uploaded());
+
+  const uint8_t line = laser_raster.attach();
+  TEST_ASSERT_EQUAL(1, line);
+  TEST_ASSERT_EQUAL(4, laser_raster.pixel_count(line - 1));
+  const uint8_t expect[] = { 0x00, 0x01, 0x02, 0xFF };
+  for (uint8_t i = 0; i < COUNT(expect); ++i) TEST_ASSERT_EQUAL(expect[i], laser_raster.pixels(line - 1)[i]);
+  laser_raster.release(line - 1);
+
+  // Every 6-bit value
+  TEST_ASSERT_TRUE(laser_raster.append_base64("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"));
+  TEST_ASSERT_EQUAL(48, laser_raster.uploaded());
+  const uint8_t all = laser_raster.attach();
+  const uint8_t * const p = laser_raster.pixels(all - 1);
+  for (uint8_t i = 0; i < 64; ++i) {
+    const uint16_t bit = i * 6, byte = bit / 8, shift = bit % 8;
+    const uint16_t word = (p[byte] << 8) | (byte + 1 < 48 ? p[byte + 1] : 0);
+    TEST_ASSERT_EQUAL(i, (word >> (10 - shift)) & 0x3F);
+  }
+  laser_raster.release(all - 1);
+}
+
+MARLIN_TEST(laser_raster, line_too_long) {
+  laser_raster.clear();
+
+  // 4 chars per 3 pixels, so this is 3 pixels more than fit
+  char str[(LASER_RASTER_PIXELS / 3 + 2) * 4 + 1];
+  memset(str, 'A', sizeof(str) - 1);
+  str[sizeof(str) - 1] = '\0';
+  TEST_ASSERT_FALSE(laser_raster.append_base64(str));
+  TEST_ASSERT_EQUAL(LASER_RASTER_PIXELS, laser_raster.uploaded());
+
+  laser_raster.discard();
+  TEST_ASSERT_EQUAL(0, laser_raster.uploaded());
+  TEST_ASSERT_EQUAL(0, laser_raster.attach());
+}
+
+MARLIN_TEST(laser_raster, ring) {
+  laser_raster.clear();
+
+  // No line uploaded, so a block gets none
+  TEST_ASSERT_EQUAL(0, laser_raster.attach());
+
+  // Lines go around the ring in order, each with its own pixels
+  uint8_t prev = 0;
+  for (uint8_t n = 0; n < 3 * LASER_RASTER_LINES; ++n) {
+    TEST_ASSERT_TRUE(laser_raster.append_base64(n & 1 ? "//8A" : "AAD/"));
+    const uint8_t line = laser_raster.attach();
+    TEST_ASSERT_TRUE(WITHIN(line, 1, LASER_RASTER_LINES));
+    if (prev) TEST_ASSERT_EQUAL(prev % LASER_RASTER_LINES + 1, line);
+    TEST_ASSERT_EQUAL(3, laser_raster.pixel_count(line - 1));
+    TEST_ASSERT_EQUAL(n & 1 ? 0xFF : 0x00, laser_raster.pixels(line - 1)[0]);
+    TEST_ASSERT_EQUAL(0, laser_raster.uploaded());
+    TEST_ASSERT_EQUAL(0, laser_raster.attach());
+    laser_raster.release(line - 1);
+    prev = line;
+  }
+
+  // Fill every line but the one being uploaded, then free them oldest first
+  uint8_t lines[LASER_RASTER_LINES - 1];
+  for (uint8_t n = 0; n < COUNT(lines); ++n) {
+    TEST_ASSERT_TRUE(laser_raster.append_base64("AQID"));
+    lines[n] = laser_raster.attach();
+  }
+  for (uint8_t n = 0; n < COUNT(lines); ++n) {
+    TEST_ASSERT_EQUAL(3, laser_raster.pixel_count(lines[n] - 1));
+    laser_raster.release(lines[n] - 1);
+  }
+
+  // With all lines free an upload doesn't wait
+  TEST_ASSERT_TRUE(laser_raster.append_base64("AQID"));
+  TEST_ASSERT_EQUAL(3, laser_raster.uploaded());
+
+  // A quick stop drops everything
+  laser_raster.clear();
+  TEST_ASSERT_EQUAL(0, laser_raster.uploaded());
+  TEST_ASSERT_EQUAL(0, laser_raster.attach());
+}
+
+MARLIN_TEST(laser_raster, zero_length_move) {
+  settings.reset();
+  planner.clear_block_buffer();
+  laser_raster.clear();
+  cutter.cutter_mode = CUTTER_MODE_CONTINUOUS;
+  planner.laser_inline.status.isPowered = true;
+
+  xyze_pos_t pos{0};
+  planner.set_position_mm(pos);
+  TEST_ASSERT_TRUE(laser_raster.append_base64("AQID"));
+
+  // A move too short to be queued leaves the line for the next one
+  planner.buffer_line(pos, 100);
+  TEST_ASSERT_EQUAL(0, planner.movesplanned());
+  TEST_ASSERT_EQUAL(3, laser_raster.uploaded());
+
+  pos.x = 10;
+  planner.buffer_line(pos, 100);
+  TEST_ASSERT_EQUAL(1, planner.movesplanned());
+  TEST_ASSERT_EQUAL(0, laser_raster.uploaded());
+  const block_t &block = planner.block_buffer[planner.block_buffer_tail];
+  TEST_ASSERT_TRUE(block.laser.raster);
+  if (block.laser.raster) {
+    TEST_ASSERT_EQUAL(3, laser_raster.pixel_count(block.laser.raster - 1));
+    TEST_ASSERT_EQUAL(0x01, laser_raster.pixels(block.laser.raster - 1)[0]);
+  }
+
+  planner.laser_inline.status.isPowered = false;
+  cutter.cutter_mode = CUTTER_MODE_STANDARD;
+  planner.clear_block_buffer();
+  laser_raster.clear();
+}
+
+#endif // LASER_RASTER
@@ -0,0 +1,112 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(GRADIENT_MIX)
+
+#include <src/feature/mixing.h>
+
+#include <chrono>
+
+// A gradient from a 3:1 mix (V-tool 2) to pure filament 2 (V-tool 1) over 0-10mm
+static void start_gradient() {
+  mixer.init();
+  mixer.collector[0] = 3; mixer.collector[1] = 1;
+  mixer.normalize(2);
+  mixer.gradient.start_z = 0;
+  mixer.gradient.end_z = 10;
+  mixer.gradient.start_vtool = 2;
+  mixer.gradient.end_vtool = 1;
+  mixer.T(0);
+  mixer.refresh_gradient();
+}
+
+// The color at a gradient step, worked out in float as the mix was before
+static void reference_color(const int8_t step, mixer_comp_t (&color)[MIXING_STEPPERS]) {
+  const float pct = step / 100.0f;
+  mixer_perc_t mix[MIXING_STEPPERS], mmax = 0;
+  MIXER_STEPPER_LOOP(i) {
+    const mixer_perc_t sm = mixer.gradient.start_mix[i];
+    mix[i] = sm + (mixer.gradient.end_mix[i] - sm) * pct;
+    NOLESS(mmax, mix[i]);
+  }
+  const float scale = float(COLOR_A_MASK) / mmax;
+  MIXER_STEPPER_LOOP(i) color[i] = mix[i] * scale;
+}
+
+MARLIN_TEST(mixing, gradient_steps) {
+  start_gradient();
+  TEST_ASSERT_TRUE(mixer.gradient.enabled);
+
+  mixer_comp_t b_color[MIXING_STEPPERS], ref[MIXING_STEPPERS];
+  for (int8_t step = 0; step < 100; ++step) {
+    mixer.gradient_control(step * 0.1f + 0.05f);
+    TEST_ASSERT_EQUAL(step, mixer.gradient.step);
+    mixer.populate_block(b_color);
+    reference_color(step, ref);
+    // Within 1% of the mix. The largest component is at least 50%.
+    MIXER_STEPPER_LOOP(i) TEST_ASSERT_TRUE(ABS(int32_t(b_color[i]) - int32_t(ref[i])) <= int32_t(COLOR_A_MASK) / 50);
+  }
+}
+
+MARLIN_TEST(mixing, gradient_ends) {
+  start_gradient();
+  mixer_comp_t b_color[MIXING_STEPPERS];
+
+  // Below the start the mix is the start mix, 3:1
+  mixer.gradient_control(-1);
+  mixer.populate_block(b_color);
+  TEST_ASSERT_EQUAL(COLOR_A_MASK, b_color[0]);
+  TEST_ASSERT_TRUE(ABS(int32_t(b_color[1]) * 3 - int32_t(COLOR_A_MASK)) < 3 * 0x400);
+  TEST_ASSERT_EQUAL(0, b_color[2]);
+
+  // At the end the end V-tool is selected
+  mixer.gradient_control(10);
+  TEST_ASSERT_EQUAL(1, mixer.get_current_vtool());
+}
+
+// Blocks per second through the planner's mixer calls, with Z rising on every block as in vase mode
+static double blocks_per_second(const bool gradient) {
+  constexpr uint32_t count = 2000000;
+  start_gradient();
+  if (!gradient) mixer.gradient.enabled = false;
+  mixer_comp_t b_color[MIXING_STEPPERS];
+  uint32_t check = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t n = 0; n < count; ++n) {
+    TERN_(GRADIENT_MIX, mixer.gradient_control(n * (9.9f / count)));
+    mixer.populate_block(b_color);
+    mixer.stepper_setup(b_color);
+    check += b_color[0];
+  }
+  const std::chrono::duration<double> secs = std::chrono::steady_clock::now() - start;
+  TEST_ASSERT_TRUE(check > 0);
+  return count / secs.count();
+}
+
+MARLIN_TEST(mixing, gradient_throughput) {
+  const double off = blocks_per_second(false), on = blocks_per_second(true);
+  printf("gradient off: %.0f blocks/s, on: %.0f blocks/s\n", off, on);
+}
+
+#endif // GRADIENT_MIX
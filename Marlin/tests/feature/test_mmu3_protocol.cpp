@@ -0,0 +1,86 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * The MMU3 framing and CRC don't need an MMU, so they're built for every test config
+ */
+
+#include "../test/unit_tests.h"
+#include <src/feature/mmu3/mmu3_protocol.h>
+
+using namespace modules::protocol;
+using modules::crc::CRC8;
+
+// CRC8 CCITT (poly 0x07), one bit at a time
+static uint8_t crc8_bitwise(const uint8_t crc, const uint8_t b) {
+  uint8_t data = crc ^ b;
+  for (uint8_t i = 0; i < 8; i++)
+    data = (data & 0x80U) ? uint8_t(data << 1) ^ 0x07U : uint8_t(data << 1);
+  return data;
+}
+
+MARLIN_TEST(mmu3_protocol, crc_matches_bitwise) {
+  for (uint16_t crc = 0; crc < 256; ++crc)
+    for (uint16_t b = 0; b < 256; ++b) {
+      TEST_ASSERT_EQUAL(crc8_bitwise(crc, b), CRC8::CCITT_updateCX(crc, b));
+      TEST_ASSERT_EQUAL(crc8_bitwise(crc, b), CRC8::CCITT_update(crc, b));
+    }
+}
+
+MARLIN_TEST(mmu3_protocol, responses_back_to_back) {
+  // Several responses in one receive buffer, as they arrive from the MMU
+  const RequestMsg query(RequestMsgCodes::Query, 0), tool(RequestMsgCodes::Tool, 2), read(RequestMsgCodes::Read, 0x1A);
+  uint8_t rx[64];
+  uint8_t len = Protocol::EncodeResponseCmdAR(tool, ResponseMsgParamCodes::Accepted, rx);
+  len += Protocol::EncodeResponseQueryOperation(query, ResponseCommandStatus(ResponseMsgParamCodes::Processing, 3), rx + len);
+  len += Protocol::EncodeResponseRead(read, true, 0x1234, rx + len);
+  TEST_ASSERT_TRUE(len <= sizeof(rx));
+
+  const ResponseMsg expect[] = {
+    ResponseMsg(tool, ResponseMsgParamCodes::Accepted, 0),
+    ResponseMsg(query, ResponseMsgParamCodes::Processing, 3),
+    ResponseMsg(read, ResponseMsgParamCodes::Accepted, 0x1234)
+  };
+
+  Protocol protocol;
+  uint8_t done = 0;
+  for (uint8_t i = 0; i < len; ++i) {
+    const DecodeStatus ds = protocol.DecodeResponse(rx[i]);
+    TEST_ASSERT_TRUE(ds != DecodeStatus::Error);
+    if (ds != DecodeStatus::MessageCompleted) continue;
+    const ResponseMsg rsp = protocol.GetResponseMsg();
+    TEST_ASSERT_TRUE(done < COUNT(expect));
+    TEST_ASSERT_TRUE(rsp.request.code == expect[done].request.code);
+    TEST_ASSERT_EQUAL(expect[done].request.value, rsp.request.value);
+    TEST_ASSERT_TRUE(rsp.paramCode == expect[done].paramCode);
+    TEST_ASSERT_EQUAL(expect[done].paramValue, rsp.paramValue);
+    TEST_ASSERT_EQUAL(expect[done].getCRC(), rsp.getCRC());
+    ++done;
+  }
+  TEST_ASSERT_EQUAL(COUNT(expect), done);
+
+  // A damaged byte fails the CRC
+  rx[1] ^= 0x01;
+  DecodeStatus ds = DecodeStatus::NeedMoreData;
+  for (uint8_t i = 0; i < len && ds == DecodeStatus::NeedMoreData; ++i) ds = protocol.DecodeResponse(rx[i]);
+  TEST_ASSERT_TRUE(ds == DecodeStatus::Error);
+}
@@ -0,0 +1,91 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * The drift model fitted to a made-up bed probed over and over while warming up.
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(PTC_ONLINE_FIT)
+
+#include <src/feature/probe_temp_comp.h>
+
+// (µm/°C) The drift of the made-up probe
+static float true_k(const uint8_t s) {
+  return TERN_(PTC_PROBE, s == TSI_PROBE ? -6.0f :) TERN_(PTC_BED, s == TSI_BED ? 4.0f :) 1.5f;
+}
+
+// A warped bed, in mm
+static float bed_z(const xy_pos_t &pos) { return 0.0004f * (pos.x - 100) * (pos.y - 80) + 0.001f * pos.x; }
+
+// Noise of a few µm, the same on every run
+static float noise(const uint32_t n) { return (int32_t((n * 2654435761UL) >> 24 & 0x0F) - 8) * 0.001f; }
+
+// Probe a 3x3 grid once per session, each time at other temperatures
+static void probe_sessions(const uint8_t sessions, const float bed_shift=0) {
+  uint32_t n = 0;
+  for (uint8_t session = 0; session < sessions; ++session) {
+    for (uint8_t i = 0; i < 9; ++i, ++n) {
+      const xy_pos_t pos = { 20.0f + 80 * (i % 3), 20.0f + 80 * (i / 3) };
+      float u[TSI_COUNT], z = bed_z(pos) + bed_shift + noise(n);
+      for (uint8_t s = 0; s < TSI_COUNT; ++s) {
+        // Each sensor warms at its own pace, so the changes are not all in proportion
+        u[s] = (s + 1) * 3.0f * session + ((session + s) & 1) * 5.0f + i * 0.2f * (s + 1);
+        z += true_k(s) * u[s] / 1000.0f;
+      }
+      ptc.fit_observe(pos, z, u);
+    }
+  }
+}
+
+MARLIN_TEST(probe_temp_comp, fit_drift) {
+  ptc.reset_model();
+  probe_sessions(8);
+  TEST_ASSERT_TRUE(ptc.model.samples > 30);
+  for (uint8_t s = 0; s < TSI_COUNT; ++s)
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, true_k(s), ptc.model.k[s]);
+}
+
+MARLIN_TEST(probe_temp_comp, model_offset) {
+  ptc.reset_model();
+  probe_sessions(8);
+  float u[TSI_COUNT], expect = 0;
+  for (uint8_t s = 0; s < TSI_COUNT; ++s) { u[s] = 10; expect += true_k(s) * 10; }
+  TEST_ASSERT_FLOAT_WITHIN(10.0f, expect, ptc.model_offset(u));
+}
+
+MARLIN_TEST(probe_temp_comp, reject_changed_bed) {
+  ptc.reset_model();
+  probe_sessions(8);
+  float k[TSI_COUNT];
+  for (uint8_t s = 0; s < TSI_COUNT; ++s) k[s] = ptc.model.k[s];
+
+  // Moving the bed 1mm isn't drift. The first probe of each point must not change the model.
+  const uint16_t samples = ptc.model.samples;
+  probe_sessions(1, 1.0f);
+  TEST_ASSERT_EQUAL(samples, ptc.model.samples);
+  for (uint8_t s = 0; s < TSI_COUNT; ++s)
+    TEST_ASSERT_EQUAL_FLOAT(k[s], ptc.model.k[s]);
+}
+
+#endif // PTC_ONLINE_FIT
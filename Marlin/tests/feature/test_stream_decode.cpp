@@ -0,0 +1,136 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if HAS_HEATSHRINK_STREAM
+
+#include <src/feature/stream_decode.h>
+#include "heatshrink_encoder.h"
+
+#include <string>
+
+typedef std::vector<uint8_t> bytes_t;
+
+static bytes_t bytes(const std::string &s) { return bytes_t(s.begin(), s.end()); }
+
+static bytes_t header(const size_t size) {
+  const uint8_t lsb = uint8_t(size), msb = uint8_t(size >> 8);
+  return { 0xFE, 0xFE, lsb, msb, uint8_t(lsb ^ msb ^ 0xFF) };
+}
+
+static bytes_t frame(const bytes_t &data) {
+  const bytes_t packed = heatshrink_encode(data);
+  bytes_t out = header(packed.size());
+  out.insert(out.end(), packed.begin(), packed.end());
+  return out;
+}
+
+static void append(bytes_t &in, const bytes_t &more) { in.insert(in.end(), more.begin(), more.end()); }
+
+// Run input through the decoder the way StreamDecodeSerial does
+static std::string decode(StreamDecoder &decoder, const bytes_t &in) {
+  std::string out;
+  size_t i = 0;
+  for (;;) {
+    if (!decoder.available()) {
+      if (decoder.wants_input())
+        while (!decoder.input_full() && i < in.size()) decoder.put(in[i++]);
+      decoder.process();
+      if (!decoder.available()) { if (i == in.size()) break; continue; }
+    }
+    out += char(decoder.read());
+  }
+  return out;
+}
+
+// Some sliced G-code
+static std::string gcode(const int lines) {
+  std::string s;
+  char line[64];
+  for (int i = 0; i < lines; ++i) {
+    snprintf(line, sizeof(line), "N%d G1 X%d.%03d Y%d.%03d E%d.%05d*%d\n", i, 100 + i % 37, i * 7 % 1000, 80 + i % 23, i * 13 % 1000, i / 10, i * 31 % 100000, i % 256);
+    s += line;
+  }
+  return s;
+}
+
+MARLIN_TEST(stream_decode, plain_passes_through) {
+  StreamDecoder decoder;
+  const std::string text = gcode(10);
+  TEST_ASSERT_TRUE(decode(decoder, bytes(text)) == text);
+
+  // A lone frame mark is data, as in MeatPack
+  const bytes_t odd = { 'A', 0xFE, 'B', 0xFE };
+  const std::string out = decode(decoder, odd);
+  TEST_ASSERT_TRUE(out == std::string(odd.begin(), odd.end() - 1)); // The last mark waits for the next byte
+  TEST_ASSERT_TRUE(decode(decoder, { 'C' }) == "\xFE" "C");
+}
+
+MARLIN_TEST(stream_decode, frames_in_order) {
+  StreamDecoder decoder;
+  const std::string a = gcode(5), b = gcode(25), c = "M105\n";
+  bytes_t in = bytes(a);
+  append(in, frame(bytes(b)));
+  append(in, bytes(c));
+  TEST_ASSERT_TRUE(decode(decoder, in) == a + b + c);
+
+  // An empty frame is ignored
+  TEST_ASSERT_TRUE(decode(decoder, { 0xFE, 0xFE, 0, 0, 0xFF, 'G', '4', '\n' }) == "G4\n");
+}
+
+MARLIN_TEST(stream_decode, bad_header_resyncs) {
+  StreamDecoder decoder;
+  const std::string a = gcode(20), b = gcode(30);
+
+  // A damaged size is caught by the check byte. The frame is dropped up to the next frame.
+  bytes_t bad = frame(bytes(a));
+  bad[2] ^= 0x40;
+  bytes_t in = bad;
+  append(in, frame(bytes(b)));
+  TEST_ASSERT_TRUE(decode(decoder, in) == b);
+
+  // A frame over the size limit is dropped too
+  in = header(2000);
+  append(in, bytes_t(100, 'x'));
+  append(in, frame(bytes(b)));
+  TEST_ASSERT_TRUE(decode(decoder, in) == b);
+
+  // Without another frame, plain input comes through after the largest frame size
+  in = bad;
+  append(in, bytes_t(1024 - (bad.size() - 5), '\n'));
+  append(in, bytes("M105\n"));
+  TEST_ASSERT_TRUE(decode(decoder, in) == "M105\n");
+}
+
+MARLIN_TEST(stream_decode, compression_ratio) {
+  StreamDecoder decoder;
+  const std::string text = gcode(500);
+  bytes_t in;
+  // Frames of about 1K, as a host would send
+  for (size_t i = 0; i < text.size(); i += 1024) append(in, frame(bytes(text.substr(i, 1024))));
+  TEST_ASSERT_TRUE(decode(decoder, in) == text);
+  printf("%u bytes of G-code in %u bytes\n", unsigned(text.size()), unsigned(in.size()));
+  TEST_ASSERT_TRUE(in.size() * 3 < text.size() * 2);
+}
+
+#endif // HAS_HEATSHRINK_STREAM
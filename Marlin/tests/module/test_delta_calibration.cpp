@@ -0,0 +1,164 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Least-squares delta calibration with probe results made up from a
+ * "true" machine that differs from the settings in the firmware.
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(DELTA_CALIBRATION_LEAST_SQUARES)
+
+#include <src/module/delta_calibration.h>
+#include <src/module/delta.h>
+#include <src/module/motion.h>
+
+struct machine_t {
+  float height, radius, rod;
+  abc_float_t endstop_adj, tower_angle_trim;
+};
+
+static void use_settings(const machine_t &m) {
+  delta_height = m.height;
+  delta_radius = m.radius;
+  delta_diagonal_rod = m.rod;
+  delta_endstop_adj = m.endstop_adj;
+  delta_tower_angle_trim = m.tower_angle_trim;
+  recalc_delta_settings();
+}
+
+// Carriage heights at home less the endstop adjustments
+static abc_float_t home_heights() {
+  inverse_kinematics(xyz_pos_t({ 0, 0, delta_height }));
+  abc_float_t home = delta;
+  return home - delta_endstop_adj;
+}
+
+/**
+ * Probe the flat bed of the true machine at xy using the firmware settings.
+ * The firmware lowers the nozzle at xy (in its own view) until the true
+ * nozzle height is zero, and reports the height it thinks it is at.
+ */
+static float probe_z(const machine_t &truth, const machine_t &firmware, const xy_pos_t &xy) {
+  auto true_z = [&](const float z) {
+    use_settings(firmware);
+    const abc_float_t home = home_heights();
+    inverse_kinematics(xyz_pos_t({ xy.x, xy.y, z }));
+    abc_float_t carriage = delta;
+    carriage -= home;
+    use_settings(truth);
+    forward_kinematics(carriage + home_heights());
+    return cartes.z;
+  };
+  // The true height follows the reported height almost 1:1
+  float z = 0;
+  for (uint8_t i = 0; i < 8; ++i) {
+    const float t = true_z(z), slope = (true_z(z + 0.1f) - t) / 0.1f;
+    z -= t / slope;
+  }
+  return z;
+}
+
+static void probe_all(DeltaCalibration &cal, const machine_t &truth, const machine_t &firmware, const uint8_t rings, const float noise=0) {
+  const uint8_t count = DeltaCalibration::point_count(rings);
+  for (uint8_t i = 0; i < count; ++i) {
+    const xy_pos_t xy = DeltaCalibration::point(i, rings, 120);
+    const float z = probe_z(truth, firmware, xy) + (i & 1 ? noise : -noise);
+    use_settings(firmware);
+    cal.add_point(xy, z);
+  }
+  use_settings(firmware);
+}
+
+static const machine_t nominal = { 250.0f, 124.0f, 250.0f, { 0, 0, 0 }, { 0, 0, 0 } };
+
+MARLIN_TEST(delta_calibration, probe_points) {
+  TEST_ASSERT_EQUAL(7, DeltaCalibration::point_count(1));
+  TEST_ASSERT_EQUAL(37, DeltaCalibration::point_count(3));
+  TEST_ASSERT_EQUAL(DeltaCalibration::max_points, DeltaCalibration::point_count(DeltaCalibration::max_rings));
+
+  // Center, then rings out to the radius starting at the A tower
+  TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, DeltaCalibration::point(0, 3, 120).x);
+  const xy_pos_t a = DeltaCalibration::point(1, 3, 120);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 40.0f, HYPOT(a.x, a.y));
+  TEST_ASSERT_TRUE(a.x < 0 && a.y < 0);
+  const xy_pos_t outer = DeltaCalibration::point(36, 3, 120);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 120.0f, HYPOT(outer.x, outer.y));
+}
+
+MARLIN_TEST(delta_calibration, calibrated_machine) {
+  // The settings are right, so the bed is flat and nothing changes
+  DeltaCalibration cal;
+  probe_all(cal, nominal, nominal, 2);
+  TEST_ASSERT_FLOAT_WITHIN(0.0005f, 0.0f, cal.rms());
+  cal.fit(true);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, nominal.radius, delta_radius);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, nominal.rod, delta_diagonal_rod);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, nominal.height, delta_height);
+}
+
+MARLIN_TEST(delta_calibration, one_pass) {
+  // A machine with all its settings wrong
+  const machine_t truth = { 251.2f, 125.3f, 251.5f, { -0.40f, 0, -0.85f }, { 0.35f, -0.20f, -0.15f } };
+  DeltaCalibration cal;
+  probe_all(cal, truth, nominal, 3);
+  const float rms_before = cal.rms();
+  TEST_ASSERT_TRUE(rms_before > 0.1f);
+
+  const uint8_t iterations = cal.fit(true);
+  printf("%u points, %u iterations, std dev %.3f -> %.4f\n", cal.points(), iterations, rms_before, cal.rms());
+  TEST_ASSERT_TRUE(cal.rms() < 0.002f);
+  TEST_ASSERT_TRUE(cal.max_residual() < 0.005f);
+
+  // The settings found are the true ones
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, truth.radius, delta_radius);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, truth.rod, delta_diagonal_rod);
+  TEST_ASSERT_FLOAT_WITHIN(0.02f, truth.height, delta_height);
+  LOOP_ABC(t) {
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, truth.endstop_adj[t], delta_endstop_adj[t]);
+    TEST_ASSERT_FLOAT_WITHIN(0.02f, truth.tower_angle_trim[t], delta_tower_angle_trim[t]);
+  }
+}
+
+MARLIN_TEST(delta_calibration, fixed_tower_angles) {
+  // Without the angles the endstops and radius are still fitted
+  const machine_t truth = { 249.5f, 123.4f, 250.0f, { 0, -0.30f, -0.55f }, { 0, 0, 0 } };
+  DeltaCalibration cal;
+  probe_all(cal, truth, nominal, 2);
+  cal.fit(false);
+  TEST_ASSERT_TRUE(cal.rms() < 0.002f);
+  TEST_ASSERT_FLOAT_WITHIN(0.05f, truth.radius, delta_radius);
+  LOOP_ABC(t) TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, delta_tower_angle_trim[t]);
+}
+
+MARLIN_TEST(delta_calibration, noisy_probe) {
+  // Probe noise is left in the residuals, not fitted away
+  const machine_t truth = { 250.6f, 124.8f, 250.0f, { -0.20f, -0.10f, 0 }, { 0.10f, 0, -0.10f } };
+  DeltaCalibration cal;
+  probe_all(cal, truth, nominal, 4, 0.01f);
+  cal.fit(true);
+  TEST_ASSERT_FLOAT_WITHIN(0.002f, 0.01f, cal.rms());
+  TEST_ASSERT_FLOAT_WITHIN(0.1f, truth.radius, delta_radius);
+}
+
+#endif // DELTA_CALIBRATION_LEAST_SQUARES
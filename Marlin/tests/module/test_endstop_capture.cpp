@@ -0,0 +1,92 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Steps taken back from an endstop trigger to the captured edge
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(ENDSTOP_CAPTURE)
+
+#include <src/module/stepper.h>
+
+// Fill the step history as the Stepper ISR would
+static void add_step(const uint32_t time, const AxisEnum axis) {
+  Stepper::step_time_t &s = stepper.step_history[stepper.step_history_index];
+  s.time = time;
+  s.axes.reset();
+  s.axes.set(axis);
+  if (++stepper.step_history_index >= ENDSTOP_CAPTURE_STEPS) stepper.step_history_index = 0;
+  if (stepper.step_history_count < ENDSTOP_CAPTURE_STEPS) stepper.step_history_count++;
+}
+
+static void new_block() { stepper.step_history_count = 0; }
+
+MARLIN_TEST(endstop_capture, steps_after_edge) {
+  new_block();
+  for (uint32_t t = 100; t <= 500; t += 100) add_step(t, Z_AXIS);
+
+  // Three steps came after the edge, which was half way to the next step
+  float part;
+  TEST_ASSERT_EQUAL(3, stepper.steps_after_edge(Z_AXIS, 250, part));
+  TEST_ASSERT_EQUAL_FLOAT(0.5f, part);
+
+  // No steps after an edge seen at the last step
+  TEST_ASSERT_EQUAL(0, stepper.steps_after_edge(Z_AXIS, 500, part));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, part);
+
+  // The history doesn't go back far enough
+  TEST_ASSERT_EQUAL(0, stepper.steps_after_edge(Z_AXIS, 50, part));
+}
+
+MARLIN_TEST(endstop_capture, other_axes_skipped) {
+  new_block();
+  add_step(100, Z_AXIS);
+  add_step(150, X_AXIS);
+  add_step(200, Z_AXIS);
+  add_step(250, X_AXIS);
+  add_step(300, Z_AXIS);
+
+  float part;
+  TEST_ASSERT_EQUAL(2, stepper.steps_after_edge(Z_AXIS, 125, part));
+  TEST_ASSERT_EQUAL_FLOAT(0.25f, part);
+  TEST_ASSERT_EQUAL(1, stepper.steps_after_edge(X_AXIS, 200, part));
+  TEST_ASSERT_EQUAL_FLOAT(0.5f, part);
+}
+
+MARLIN_TEST(endstop_capture, history_wraps) {
+  new_block();
+  // More steps than the history holds, with the timer rolling over
+  const uint32_t start = UINT32_MAX - 5 * ENDSTOP_CAPTURE_STEPS;
+  for (uint32_t n = 0; n < 2 * ENDSTOP_CAPTURE_STEPS; ++n) add_step(start + n * 10, Y_AXIS);
+
+  float part;
+  const uint32_t last = start + (2 * ENDSTOP_CAPTURE_STEPS - 1) * 10;
+  TEST_ASSERT_EQUAL(4, stepper.steps_after_edge(Y_AXIS, last - 38, part));
+  TEST_ASSERT_EQUAL_FLOAT(0.2f, part);
+
+  // The oldest steps were overwritten
+  TEST_ASSERT_EQUAL(0, stepper.steps_after_edge(Y_AXIS, start + 5, part));
+}
+
+#endif // ENDSTOP_CAPTURE
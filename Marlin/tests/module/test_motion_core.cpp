@@ -0,0 +1,117 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Moves handed from the main core to the planner on the motion core, and
+ * from there to the Stepper ISR. The LINUX HAL runs the motion core on its
+ * own thread, and a second thread takes the place of the Stepper ISR.
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(MOTION_CORE)
+
+#include <src/MarlinCore.h>
+#include <src/module/motion.h>
+#include <src/module/motion_core.h>
+#include <src/module/planner.h>
+#include <src/module/settings.h>
+
+#include <thread>
+
+static void ready_to_move() {
+  // No thread sends serial output in the tests. Drop it so SERIAL_ECHO won't block.
+  while (MYSERIAL1.transmit_buffer.available()) MYSERIAL1.transmit_buffer.read();
+  // The main core waits in idle(), so no kill button can be pressed
+  TERN_(HAS_KILL, WRITE(KILL_PIN, !KILL_PIN_STATE));
+  static bool started;
+  if (!started) {
+    settings.reset();
+    planner.clear_block_buffer();
+    motion_core.start();
+    started = true;
+  }
+  lf_store(planner.cleaning_buffer_counter, uint16_t(0)); // Done waiting after a quick stop
+  current_position.reset();
+  sync_plan_position();
+}
+
+MARLIN_TEST(motion_core, planner_to_stepper) {
+  ready_to_move();
+  constexpr uint16_t count = 200;
+  static const int32_t steps_per_move = LROUND(planner.settings.axis_steps_per_mm[X_AXIS]);
+  static uint32_t errors;
+  errors = 0;
+
+  // Take the place of the Stepper ISR. Every block arrives complete and planned, once, in order.
+  std::thread stepper_isr([]{
+    for (uint16_t done = 0; done < count;) {
+      block_t * const block = planner.get_current_block();
+      if (!block) { std::this_thread::yield(); continue; }
+      if (!block->is_sync()) {
+        const bool forward = block->direction_bits.x == !(done & 1);
+        if (block->steps.x != uint32_t(steps_per_move) || !forward || block->flag.recalculate) errors++;
+        done++;
+      }
+      planner.release_current_block();
+    }
+  });
+
+  // Back and forth, so each block has a known direction
+  for (uint16_t i = 0; i < count; ++i) {
+    current_position.x += (i & 1) ? -1 : 1;
+    if (!planner.buffer_line(current_position, 100)) errors++;
+  }
+
+  stepper_isr.join();
+  TEST_ASSERT_EQUAL(0, errors);
+  TEST_ASSERT_FALSE(motion_core.busy());
+  TEST_ASSERT_FALSE(planner.has_blocks_queued());
+}
+
+MARLIN_TEST(motion_core, quick_stop) {
+  ready_to_move();
+
+  // With no Stepper ISR the blocks fill up, and the motion core waits for room.
+  // Stop it from another thread, as an emergency command would.
+  std::thread stopper([]{
+    while (planner.moves_free()) std::this_thread::yield();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    planner.quick_stop();
+  });
+
+  // The main core only waits once the command queue is full too. After the stop the moves are refused.
+  constexpr uint16_t count = 2 * (BLOCK_BUFFER_SIZE + MOTION_CORE_QUEUE_SIZE);
+  uint16_t refused = 0;
+  for (uint16_t i = 0; i < count; ++i) {
+    current_position.x += (i & 1) ? -1 : 1;
+    if (!planner.buffer_line(current_position, 100)) refused++;
+  }
+
+  stopper.join();
+  TEST_ASSERT_TRUE(refused > 0);
+  TEST_ASSERT_TRUE(count - refused > BLOCK_BUFFER_SIZE); // More moves handed over than the planner can hold
+  TEST_ASSERT_FALSE(motion_core.busy());
+  TEST_ASSERT_FALSE(planner.has_blocks_queued());
+}
+
+#endif // MOTION_CORE
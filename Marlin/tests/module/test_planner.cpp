@@ -0,0 +1,266 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Known values for the planner and stepper math, and the time each kernel
+ * takes per call on the host, so a faster version can be checked against both.
+ */
+
+#include "../test/unit_tests.h"
+
+#include <src/module/planner.h>
+#include <src/module/stepper.h>
+#include <src/module/settings.h>
+
+#include <chrono>
+
+// Reach the private planner math
+class PlannerTest {
+  public:
+    static float max_allowable_speed_sqr(const_float_t accel, const_float_t target_velocity_sqr, const_float_t distance) {
+      return Planner::max_allowable_speed_sqr(accel, target_velocity_sqr, distance);
+    }
+    static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_speed, const_float_t exit_speed) {
+      Planner::calculate_trapezoid_for_block(block, entry_speed, exit_speed);
+    }
+    #if HAS_JUNCTION_DEVIATION
+      static void normalize_junction_vector(xyze_float_t &vector) { Planner::normalize_junction_vector(vector); }
+      static float limit_value_by_axis_maximum(const_float_t max_value, xyze_float_t &unit_vec) {
+        return Planner::limit_value_by_axis_maximum(max_value, unit_vec);
+      }
+    #endif
+};
+
+// Nanoseconds per call of 'fn' over 'count' calls
+template<typename F>
+static double ns_per_call(const uint32_t count, F fn) {
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t n = 0; n < count; ++n) fn(n);
+  const std::chrono::duration<double, std::nano> ns = std::chrono::steady_clock::now() - start;
+  return ns.count() / count;
+}
+
+// A block of 'count' steps at 100 steps/mm, cruising at 100mm/s and accelerating at 1000mm/s²
+static void make_block(block_t &block, const uint32_t count) {
+  block.reset();
+  block.steps_per_mm = 100;
+  block.step_event_count = count;
+  block.nominal_rate = 10000;
+  block.acceleration_steps_per_s2 = 100000;
+}
+
+MARLIN_TEST(planner, max_allowable_speed_sqr) {
+  // The fastest entry that can brake at 1000mm/s² to 50mm/s within 1mm, as in the reverse pass
+  TEST_ASSERT_EQUAL_FLOAT(4500.0f, PlannerTest::max_allowable_speed_sqr(-1000, 2500, 1));
+  TEST_ASSERT_EQUAL_FLOAT(2500.0f, PlannerTest::max_allowable_speed_sqr(-1000, 2500, 0));
+  // Accelerating at 1000mm/s² over 1mm, as in the forward pass
+  TEST_ASSERT_EQUAL_FLOAT(500.0f, PlannerTest::max_allowable_speed_sqr(1000, 2500, 1));
+}
+
+MARLIN_TEST(planner, trapezoid_with_plateau) {
+  // 100mm from 10mm/s up to 100mm/s and back down to 10mm/s
+  block_t block;
+  make_block(block, 10000);
+  PlannerTest::calculate_trapezoid_for_block(&block, 10, 10);
+  TEST_ASSERT_EQUAL(1000, block.initial_rate);
+  TEST_ASSERT_EQUAL(1000, block.final_rate);
+  TEST_ASSERT_EQUAL(495, block.accelerate_before);
+  TEST_ASSERT_EQUAL(9505, block.decelerate_start);
+  #if ENABLED(S_CURVE_ACCELERATION)
+    TEST_ASSERT_EQUAL(10000, block.cruise_rate);
+    // 9000 steps/s gained at 100000 steps/s² takes 90ms
+    TEST_ASSERT_UINT32_WITHIN(2, uint32_t(0.09f * (STEPPER_TIMER_RATE)), block.acceleration_time);
+    TEST_ASSERT_EQUAL(block.acceleration_time, block.deceleration_time);
+  #endif
+}
+
+MARLIN_TEST(planner, trapezoid_without_plateau) {
+  // 5mm is too short to reach 100mm/s, so the block peaks half way
+  block_t block;
+  make_block(block, 500);
+  PlannerTest::calculate_trapezoid_for_block(&block, 10, 10);
+  TEST_ASSERT_EQUAL(250, block.accelerate_before);
+  TEST_ASSERT_EQUAL(250, block.decelerate_start);
+  #if ENABLED(S_CURVE_ACCELERATION)
+    TEST_ASSERT_EQUAL(7141, block.cruise_rate);   // SQRT(1000² + 2 * 100000 * 250)
+  #endif
+
+  // Exit faster than entry: more of the block accelerates
+  make_block(block, 500);
+  PlannerTest::calculate_trapezoid_for_block(&block, 10, 50);
+  TEST_ASSERT_EQUAL(5000, block.final_rate);
+  TEST_ASSERT_EQUAL(310, block.accelerate_before);  // (500 + 495 - 375) / 2
+  TEST_ASSERT_EQUAL(310, block.decelerate_start);
+}
+
+MARLIN_TEST(planner, trapezoid_limits) {
+  // Speeds below the minimal step rate are raised to it
+  block_t block;
+  make_block(block, 1000);
+  PlannerTest::calculate_trapezoid_for_block(&block, 0.000001f, 0);
+  TEST_ASSERT_EQUAL(stepper.minimal_step_rate, block.initial_rate);
+  TEST_ASSERT_EQUAL(stepper.minimal_step_rate, block.final_rate);
+
+  // Any length with speeds the planner could give it makes an ordered trapezoid within the block
+  uint32_t seed = 1;
+  auto rnd = [&seed](const uint32_t n) { seed = seed * 1664525UL + 1013904223UL; return (seed >> 8) % n; };
+  for (uint16_t i = 0; i < 2000; ++i) {
+    make_block(block, 1 + rnd(20000));
+    const float reach_sqr = 2 * 1000 * block.step_event_count * 0.01f;
+    float entry = rnd(10000) * 0.01f, exit = rnd(10000) * 0.01f;
+    NOMORE(exit, SQRT(sq(entry) + reach_sqr));
+    NOMORE(entry, SQRT(sq(exit) + reach_sqr));
+    PlannerTest::calculate_trapezoid_for_block(&block, entry, exit);
+    TEST_ASSERT_TRUE(block.accelerate_before <= block.decelerate_start);
+    TEST_ASSERT_TRUE(block.decelerate_start <= block.step_event_count);
+    #if ENABLED(S_CURVE_ACCELERATION)
+      TEST_ASSERT_TRUE(block.cruise_rate <= block.nominal_rate);
+      TEST_ASSERT_TRUE(block.cruise_rate + 1 >= block.initial_rate);
+      TEST_ASSERT_TRUE(block.cruise_rate + 1 >= block.final_rate);
+    #endif
+  }
+}
+
+#if HAS_JUNCTION_DEVIATION
+
+  MARLIN_TEST(planner, junction_vector) {
+    xyze_float_t v{0};
+    v.x = 3; v.y = 4;
+    PlannerTest::normalize_junction_vector(v);
+    TEST_ASSERT_EQUAL_FLOAT(0.6f, v.x);
+    TEST_ASSERT_EQUAL_FLOAT(0.8f, v.y);
+
+    // Along the vector the X and Y limits allow 1000/0.6 and 500/0.8
+    const float max_acc_x = planner.settings.max_acceleration_mm_per_s2[X_AXIS],
+                max_acc_y = planner.settings.max_acceleration_mm_per_s2[Y_AXIS];
+    planner.settings.max_acceleration_mm_per_s2[X_AXIS] = 1000;
+    planner.settings.max_acceleration_mm_per_s2[Y_AXIS] = 500;
+    TEST_ASSERT_EQUAL_FLOAT(625.0f, PlannerTest::limit_value_by_axis_maximum(3000, v));
+    TEST_ASSERT_EQUAL_FLOAT(400.0f, PlannerTest::limit_value_by_axis_maximum(400, v));
+    planner.settings.max_acceleration_mm_per_s2[X_AXIS] = max_acc_x;
+    planner.settings.max_acceleration_mm_per_s2[Y_AXIS] = max_acc_y;
+  }
+
+  // Plan two moves from the origin at 'fr_mm_s' and return the second block
+  static const block_t& plan_corner(const xy_pos_t &a, const xy_pos_t &b, const_feedRate_t fr_mm_s) {
+    planner.clear_block_buffer();
+    xyze_pos_t pos{0};
+    planner.set_position_mm(pos);
+    pos.x = a.x; pos.y = a.y;
+    planner.buffer_line(pos, fr_mm_s);
+    pos.x = b.x; pos.y = b.y;
+    planner.buffer_line(pos, fr_mm_s);
+    return planner.block_buffer[1];
+  }
+
+  MARLIN_TEST(planner, junction_speed) {
+    settings.reset();
+
+    // A right angle from X to Y. The junction vector is (-1, 1) / SQRT(2).
+    const block_t &block = plan_corner({ 50, 0 }, { 50, 50 }, 100);
+    const float acc = _MIN(block.acceleration,
+                           planner.settings.max_acceleration_mm_per_s2[X_AXIS] * float(M_SQRT2),
+                           planner.settings.max_acceleration_mm_per_s2[Y_AXIS] * float(M_SQRT2)),
+                sin_theta_d2 = SQRT(0.5f),
+                vmax_sqr = acc * planner.junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2);
+    TEST_ASSERT_FLOAT_WITHIN(vmax_sqr * 0.001f, vmax_sqr, block.max_entry_speed_sqr);
+
+    // Straight on, the junction is limited only by the feedrate
+    const block_t &straight = plan_corner({ 50, 0 }, { 100, 0 }, 20);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, sq(20.0f), straight.max_entry_speed_sqr);
+  }
+
+#endif // HAS_JUNCTION_DEVIATION
+
+#if ENABLED(S_CURVE_ACCELERATION)
+
+  MARLIN_TEST(planner, bezier_curve) {
+    // 1000 to 5000 steps/s over 10000 timer ticks
+    constexpr uint32_t T = 10000;
+    stepper.test_bezier_coeffs(1000, 5000, 0xFFFFFFFFUL / T);
+    TEST_ASSERT_INT32_WITHIN(1, 1000, stepper.test_bezier_eval(0));
+    TEST_ASSERT_INT32_WITHIN(2, 3000, stepper.test_bezier_eval(T / 2));
+    TEST_ASSERT_INT32_WITHIN(2, 5000, stepper.test_bezier_eval(T));
+
+    // Symmetric about the middle and always rising
+    TEST_ASSERT_INT32_WITHIN(2, 6000 - stepper.test_bezier_eval(T / 4), stepper.test_bezier_eval(T * 3 / 4));
+    int32_t prev = 0;
+    for (uint32_t t = 0; t <= T; t += 50) {
+      const int32_t v = stepper.test_bezier_eval(t);
+      TEST_ASSERT_TRUE(v >= prev);
+      prev = v;
+    }
+  }
+
+#endif // S_CURVE_ACCELERATION
+
+MARLIN_TEST(planner, kernel_timing) {
+  constexpr uint32_t count = 1000000;
+  volatile float sink = 0;
+
+  const double speed_ns = ns_per_call(count, [&](const uint32_t n) {
+    sink = PlannerTest::max_allowable_speed_sqr(-1000, float(n & 0xFFF), 0.5f);
+  });
+
+  block_t block;
+  make_block(block, 0);
+  const double trap_ns = ns_per_call(count, [&](const uint32_t n) {
+    block.step_event_count = 100 + (n & 0x3FFF);
+    PlannerTest::calculate_trapezoid_for_block(&block, float(n & 0x3F), float((n >> 6) & 0x3F));
+    sink = block.accelerate_before;
+  });
+
+  printf("max_allowable_speed_sqr: %.1f ns/call\n", speed_ns);
+  printf("calculate_trapezoid_for_block: %.1f ns/call\n", trap_ns);
+
+  #if HAS_JUNCTION_DEVIATION
+    const double jd_ns = ns_per_call(count, [&](const uint32_t n) {
+      xyze_float_t v{0};
+      v.x = 1.0f + (n & 0xFF); v.y = -1.0f - (n >> 8 & 0xFF);
+      PlannerTest::normalize_junction_vector(v);
+      sink = PlannerTest::limit_value_by_axis_maximum(3000, v);
+    });
+    printf("junction vector and limit: %.1f ns/call\n", jd_ns);
+
+    // The whole planning of a move, with the queue emptied before it fills
+    settings.reset();
+    planner.clear_block_buffer();
+    xyze_pos_t pos{0};
+    planner.set_position_mm(pos);
+    constexpr uint32_t moves = 100000;
+    const double line_ns = ns_per_call(moves, [&](const uint32_t n) {
+      if (planner.movesplanned() >= BLOCK_BUFFER_SIZE - 2) planner.clear_block_buffer();
+      pos.x = (n & 1) ? 10 : 0; pos.y = (n & 2) ? 10 : 0;
+      planner.buffer_line(pos, 100);
+    });
+    planner.clear_block_buffer();
+    printf("buffer_line: %.1f ns/call\n", line_ns);
+  #endif
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+    stepper.test_bezier_coeffs(1000, 5000, 0xFFFFFFFFUL / 0x10000);
+    const double bezier_ns = ns_per_call(count, [&](const uint32_t n) { sink = stepper.test_bezier_eval(n & 0xFFFF); });
+    printf("_eval_bezier_curve: %.1f ns/call\n", bezier_ns);
+  #endif
+
+  TEST_ASSERT_TRUE(trap_ns > 0);
+}
@@ -0,0 +1,111 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Tool-changes with TOOLCHANGE_QUEUED_MOVES leave their moves in the planner.
+ * The stepper ISR doesn't run in the tests, so any wait for the moves would hang.
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(TOOLCHANGE_QUEUED_MOVES)
+
+#include <src/MarlinCore.h>
+#include <src/module/motion.h>
+#include <src/module/planner.h>
+#include <src/module/settings.h>
+#include <src/module/temperature.h>
+#include <src/module/tool_change.h>
+
+static void ready_to_print(const xyze_pos_t &pos) {
+  // No thread sends serial output in the tests. Drop it so SERIAL_ECHO won't block.
+  while (MYSERIAL1.transmit_buffer.available()) MYSERIAL1.transmit_buffer.read();
+  settings.reset();
+  marlin_state = MarlinState::MF_RUNNING;
+  set_all_homed();
+  EXTRUDER_LOOP() thermalManager.setTargetHotend(200, e);
+  TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = true); // The hotends never heat up
+  planner.clear_block_buffer();
+  current_position = pos;
+  sync_plan_position();
+}
+
+// Count the queued moves, and the ones that extrude with tool 'e'
+static uint8_t queued_moves(const uint8_t e, uint8_t &e_moves) {
+  uint8_t moves = 0;
+  e_moves = 0;
+  bool runout_reset = false;
+  for (uint8_t i = planner.block_buffer_tail; i != planner.block_buffer_head; i = (i + 1) % (BLOCK_BUFFER_SIZE)) {
+    block_t &block = planner.block_buffer[i];
+    if (block.is_sync()) { // Position changes and runout resets ride along in the queue
+      if (block.is_sync_runout()) runout_reset = true;
+      continue;
+    }
+    ++moves;
+    if (block.extruder == e && block.steps.e) {
+      ++e_moves;
+      // The runout sensor is reset when the E move starts, not when it's queued
+      if (ENABLED(HAS_SYNC_RUNOUT)) TEST_ASSERT_TRUE(runout_reset);
+    }
+    runout_reset = false;
+  }
+  return moves;
+}
+
+MARLIN_TEST(tool_change, moves_queued) {
+  const xyze_pos_t start = { 100, 100, 10, 0 };
+  ready_to_print(start);
+
+  tool_change(1);
+  TEST_ASSERT_EQUAL(1, active_extruder);
+
+  // Raise, park, prime and return are all still in the queue
+  uint8_t e_moves;
+  TEST_ASSERT_TRUE(queued_moves(1, e_moves) >= 5);
+  TEST_ASSERT_TRUE(e_moves >= 1);
+
+  // The new tool ends up back at the position of the old one
+  TEST_ASSERT_EQUAL_FLOAT(start.x, current_position.x);
+  TEST_ASSERT_EQUAL_FLOAT(start.y, current_position.y);
+  TEST_ASSERT_EQUAL_FLOAT(start.z, current_position.z);
+}
+
+MARLIN_TEST(tool_change, swap_back_queued) {
+  const xyze_pos_t start = { 50, 60, 5, 0 };
+  ready_to_print(start);
+  tool_change(1);
+  ready_to_print(start);
+
+  // T1 is primed now, so its retract is queued along with the prime of T0
+  tool_change(0);
+  TEST_ASSERT_EQUAL(0, active_extruder);
+  uint8_t retracts, primes;
+  queued_moves(1, retracts);
+  TEST_ASSERT_TRUE(queued_moves(0, primes) >= 6);
+  TEST_ASSERT_EQUAL(1, retracts);
+  TEST_ASSERT_TRUE(primes >= 1);
+  TEST_ASSERT_EQUAL_FLOAT(start.x, current_position.x);
+  TEST_ASSERT_EQUAL_FLOAT(start.y, current_position.y);
+  TEST_ASSERT_EQUAL_FLOAT(start.z, current_position.z);
+}
+
+#endif // TOOLCHANGE_QUEUED_MOVES